@@ -75,6 +75,14 @@
     #define SET_WIFI_PWD "MyNet123456"
 #endif
 
+// Default UART Protocol Decoders included in the Firmware
+#if !defined(SET_UART_DECODER_MODBUS)
+    #define SET_UART_DECODER_MODBUS 1
+#endif
+#if !defined(SET_UART_DECODER_NMEA)
+    #define SET_UART_DECODER_NMEA 1
+#endif
+
 /*****************************************************************************/
 
 /* System Configuration Constants */
@@ -121,6 +129,45 @@ namespace ns_const
      */
     static const uint32_t DEFAULT_UART_BAUD_RATE = 115200U;
 
+    /**
+     * @brief Default size of the Rx ring buffer of each logged UART Port
+     * (must be a power of two, or 0 to derive it from the Port speed and
+     * the tolerated publish stall).
+     */
+    static const uint32_t DEFAULT_UART_RX_BUFFER_SIZE = 0U;
+
+    /**
+     * @brief Default publish stall time (ms) that the Rx ring buffer of
+     * each logged UART Port must hold at the Port speed.
+     */
+    static const uint32_t DEFAULT_UART_RX_STALL_MS = 200U;
+
+    /**
+     * @brief Default Modbus RTU sniffer response timeout (ms).
+     */
+    static const uint32_t DEFAULT_UART_MODBUS_TIMEOUT_MS = 1000U;
+
+    /**
+     * @brief Default UART automatic baud rate detection timeout (ms).
+     */
+    static const uint32_t DEFAULT_UART_AUTOBAUD_TIMEOUT_MS = 10000U;
+
+    /**
+     * @brief UART Modbus RTU sniffer decoder included in the Firmware.
+     */
+    static const bool UART_DECODER_MODBUS = (SET_UART_DECODER_MODBUS != 0);
+
+    /**
+     * @brief UART NMEA 0183 decoder included in the Firmware.
+     */
+    static const bool UART_DECODER_NMEA = (SET_UART_DECODER_NMEA != 0);
+
+    /**
+     * @brief Default size of the Tx queue of each logged UART Port (must be
+     * a power of two).
+     */
+    static const uint32_t DEFAULT_UART_TX_BUFFER_SIZE = 2048U;
+
     /**
      * @brief Default MQTT Server/Broker Host to use.
      */
@@ -91,11 +91,73 @@ namespace ns_const
      */
     static constexpr uint8_t MQTT_TOPIC_MAX_LEN = (MAC_ADDRESS_LENGTH + 25U);
 
+    /**
+     * @brief MQTT Client buffer size (maximum size of a MQTT packet,
+     * including header and topic).
+     */
+    static constexpr uint16_t MQTT_BUFFER_SIZE = 2048U;
+
     /**
      * @brief Maximum number of Serial Ports in the device.
      */
     static constexpr uint8_t MAX_NUM_UART = SOC_UART_NUM;
 
+    /**
+     * @brief Minimum size of the Rx ring buffer of an UART Port.
+     */
+    static constexpr uint32_t MIN_UART_RX_BUFFER_SIZE = 256U;
+
+    /**
+     * @brief Maximum size of the Rx ring buffer of an UART Port (allocated
+     * when the Port is enabled, from PSRAM on boards that have it).
+     */
+    #if defined(BOARD_HAS_PSRAM)
+        static constexpr uint32_t MAX_UART_RX_BUFFER_SIZE = (256U * 1024U);
+    #else
+        static constexpr uint32_t MAX_UART_RX_BUFFER_SIZE = (32U * 1024U);
+    #endif
+
+    /**
+     * @brief Maximum publish stall time (ms) to derive the Rx ring buffer
+     * size of an UART Port.
+     */
+    static constexpr uint32_t MAX_UART_RX_STALL_MS = 10000U;
+
+    /**
+     * @brief Minimum size of the Tx queue of an UART Port.
+     */
+    static constexpr uint32_t MIN_UART_TX_BUFFER_SIZE = 256U;
+
+    /**
+     * @brief Maximum size of the Tx queue of an UART Port.
+     */
+    static constexpr uint32_t MAX_UART_TX_BUFFER_SIZE = 2048U;
+
+    /**
+     * @brief Minimum size of the flight recorder history of an UART Port.
+     */
+    static constexpr uint32_t MIN_UART_REC_SIZE = 1024U;
+
+    /**
+     * @brief Maximum size of the flight recorder history of an UART Port
+     * (allocated from PSRAM on boards that have it).
+     */
+    #if defined(BOARD_HAS_PSRAM)
+        static constexpr uint32_t MAX_UART_REC_SIZE = (512U * 1024U);
+    #else
+        static constexpr uint32_t MAX_UART_REC_SIZE = (32U * 1024U);
+    #endif
+
+    /**
+     * @brief Minimum Baud Rate of an UART Port.
+     */
+    static constexpr uint32_t MIN_UART_BAUD_RATE = 300U;
+
+    /**
+     * @brief Maximum Baud Rate of an UART Port (UART hardware limit).
+     */
+    static constexpr uint32_t MAX_UART_BAUD_RATE = 5000000U;
+
     /**
      * @brief Maximum number of words in a string parsed for
      * command + arguments handling.
@@ -51,6 +51,9 @@
 // WiFi Library
 #include <WiFi.h>
 
+// ESP-IDF UART Driver
+#include "driver/uart.h"
+
 // Constant Data
 #include "constants.h"
 
@@ -72,6 +75,94 @@ namespace ns_device
 
     namespace ns_uart
     {
+        /**
+         * @brief UART Port capture engine.
+         */
+        enum class t_uart_engine : uint8_t
+        {
+            // Polled from the Interface process() (Arduino HardwareSerial)
+            POLL = 0,
+
+            // ESP-IDF UART Driver events + dedicated capture task
+            EVENT = 1
+        };
+
+        /**
+         * @brief UART Port Rx data framing mode (how the received data
+         * stream is split into MQTT messages).
+         */
+        enum class t_uart_framing : uint8_t
+        {
+            // Frames end with a delimiter character
+            LINE = 0,
+
+            // Frames end after an inter-byte silence
+            IDLE = 1,
+
+            // Frames of a fixed length
+            FIXED = 2,
+
+            // COBS encoded frames (delimited by 0x00)
+            COBS = 3,
+
+            // SLIP encoded frames (delimited by 0xC0)
+            SLIP = 4
+        };
+
+        /**
+         * @brief UART Port Rx frames timestamping mode.
+         */
+        enum class t_uart_timestamps : uint8_t
+        {
+            // Raw frames (no timestamp header)
+            OFF = 0,
+
+            // First byte arrival time of each frame
+            ON = 1,
+
+            // First byte arrival time plus per-byte inter-arrival deltas
+            DELTAS = 2
+        };
+
+        /**
+         * @brief UART Port Tx messages echo mode (publish of the accepted
+         * Tx messages to acknowledge them).
+         */
+        enum class t_uart_tx_echo : uint8_t
+        {
+            // No echo
+            OFF = 0,
+
+            // Echo of each message
+            ON = 1,
+
+            // Echo of multiple messages in a single MQTT message
+            BATCH = 2
+        };
+
+        /**
+         * @brief UART Port Rx overload policy (applied while the uplink
+         * can't keep up with the capture).
+         */
+        enum class t_uart_overload : uint8_t
+        {
+            // No policy (the capture drops the newest data when the Rx ring
+            // buffer gets full)
+            OFF = 0,
+
+            // Discard the oldest Rx data of the ring buffer
+            DROP_OLDEST = 1,
+
+            // Discard the newest Rx data at capture
+            DROP_NEWEST = 2,
+
+            // Publish only a summary of the Rx frames
+            SUMMARY = 3,
+
+            // Pause the capture (relies on the RTS flow control)
+            PAUSE = 4
+        };
+
         /**
          * @brief Device UART configuration data.
          */
@@ -83,31 +174,144 @@ namespace ns_device
             // UART Baud Rate
             uint32_t bauds;
 
-            #if 0 /* Full parameters configuration is not supported */
-                // UART Port configuration
-                uart_config_t config;
-            #endif
+            // UART Port capture engine
+            t_uart_engine engine;
+
+            // UART Port Rx ring buffer size (0: derived from the speed)
+            uint32_t rx_buffer_size;
+
+            // UART Port publish stall time to hold in the Rx ring buffer
+            uint16_t rx_stall_ms;
+
+            // UART Port Rx data framing mode
+            t_uart_framing framing;
+
+            // LINE framing delimiter character
+            uint8_t frame_delimiter;
+
+            // IDLE framing inter-byte silence (number of character times)
+            uint8_t frame_idle_chars;
+
+            // FIXED framing frame length
+            uint16_t frame_length;
+
+            // Rx frames batching maximum message size (0: disabled)
+            uint16_t batch_size;
+
+            // Rx frames batching maximum latency (ms)
+            uint16_t batch_ms;
+
+            // Rx frames timestamping mode
+            t_uart_timestamps timestamps;
+
+            // UART Port Tx queue size
+            uint32_t tx_buffer_size;
+
+            // Tx messages echo mode
+            t_uart_tx_echo tx_echo;
+
+            // Paired UART Port number for full-duplex sniffing (0: none)
+            uint8_t pair_port;
+
+            // Pair mode frames reorder window (ms)
+            uint16_t pair_window_ms;
+
+            // Bridged UART Port number for man-in-the-middle mode (0: none)
+            uint8_t bridge_port;
+
+            // Raw TCP serial server port (0: disabled)
+            uint16_t tcp_port;
+
+            // Publish line events (errors, BREAK and data losses) in-band
+            bool line_events;
+
+            // Prefix Rx messages with sequence number and stream offset
+            bool rx_seq;
+
+            // Rx log lines template encoding
+            bool templates;
+
+            // Rx messages compression
+            bool compress;
+
+            // Repeated frames collapsing window (ms, 0: disabled)
+            uint32_t dedup_ms;
+
+            // Rx protocol decoder (registry ID, 0: no decoder)
+            uint8_t decoder;
+
+            // Rx overload policy
+            t_uart_overload overload;
+
+            // Flight recorder history and post-trigger window sizes
+            // (0: recorder disabled, frames are published)
+            uint32_t rec_size;
+            uint32_t rec_post_size;
+
+            // Flight recorder trigger GPIO (-1: none) and edge (Arduino
+            // RISING, FALLING or CHANGE)
+            int8_t rec_gpio;
+            uint8_t rec_gpio_mode;
+
+            // UART Port line configuration (data bits, parity, stop bits
+            // and flow control, baud_rate is kept in sync with bauds)
+            uart_config_t config;
+
+            // UART Port Rx, Tx, RTS and CTS GPIOs (-1: Port default/none)
+            int8_t rx_pin;
+            int8_t tx_pin;
+            int8_t rts_pin;
+            int8_t cts_pin;
+
+            // High-speed capture profile (bigger driver Rx buffer and
+            // earlier Rx FIFO full interrupt)
+            bool high_speed;
 
             // Default struct initialization
             s_uart_config() :
                 enable(false),
-                bauds(ns_const::DEFAULT_UART_BAUD_RATE)
+                bauds(ns_const::DEFAULT_UART_BAUD_RATE),
+                engine(t_uart_engine::POLL),
+                rx_buffer_size(ns_const::DEFAULT_UART_RX_BUFFER_SIZE),
+                rx_stall_ms(ns_const::DEFAULT_UART_RX_STALL_MS),
+                framing(t_uart_framing::LINE),
+                frame_delimiter((uint8_t)('\n')),
+                frame_idle_chars(4U),
+                frame_length(0U),
+                batch_size(0U),
+                batch_ms(0U),
+                timestamps(t_uart_timestamps::OFF),
+                tx_buffer_size(ns_const::DEFAULT_UART_TX_BUFFER_SIZE),
+                tx_echo(t_uart_tx_echo::ON),
+                pair_port(0U),
+                pair_window_ms(0U),
+                bridge_port(0U),
+                tcp_port(0U),
+                line_events(false),
+                rx_seq(false),
+                templates(false),
+                compress(false),
+                dedup_ms(0U),
+                decoder(0U),
+                overload(t_uart_overload::OFF),
+                rec_size(0U),
+                rec_post_size(0U),
+                rec_gpio(-1),
+                rec_gpio_mode(0U),
+                config(),
+                rx_pin(-1),
+                tx_pin(-1),
+                rts_pin(-1),
+                cts_pin(-1),
+                high_speed(false)
             {
-            #if 0 /* Full parameters configuration is not supported */
+                config.baud_rate = (int)(ns_const::DEFAULT_UART_BAUD_RATE);
                 config.data_bits = UART_DATA_8_BITS;
                 config.stop_bits = UART_STOP_BITS_1;
                 config.parity = UART_PARITY_DISABLE;
-                config.flow_ctrl = UART_HW_FLOWCTRL_CTS_RTS;
+                config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
                 config.rx_flow_ctrl_thresh = 122;
-                #if SOC_UART_SUPPORT_XTAL_CLK
-                    config.source_clk = UART_SCLK_XTAL;
-                    config.baud_rate = (int)(ns_const::DEFAULT_UART_BAUD_RATE);
-                #else
-                    config.source_clk = UART_SCLK_APB;
-                    config.baud_rate = _get_effective_baudrate(
-                        ns_const::DEFAULT_UART_BAUD_RATE);
-                #endif
-            #endif
+                config.source_clk = UART_SCLK_APB;
             }
         };
 
@@ -53,6 +53,15 @@
 // MQTT Communication
 #include "../../mqtt/mqtt.h"
 
+// Network State Library
+#include "../../network/network_interface.h"
+
+// ESP-IDF High Resolution Timer
+#include "esp_timer.h"
+
+// ESP-IDF Heap Memory Allocation
+#include "esp_heap_caps.h"
+
 /*****************************************************************************/
 
 /* Object Instantiation */
@@ -73,16 +82,52 @@ InterfaceUART IfaceUART;
 InterfaceUART::InterfaceUART()
 {
     initialized = false;
-    memset((void*)(topic_status), 0, ns_const::MQTT_TOPIC_MAX_LEN);
+    memset((void*)(topic_status), 0, sizeof(topic_status));
     for (uint8_t i = 0U; i < ns_const::MAX_NUM_UART; i++)
     {
         SerialPort[i] = nullptr;
-        memset((void*)(topic_cfg[i]), 0, ns_const::MQTT_TOPIC_MAX_LEN);
-        memset((void*)(topic_rx[i]), 0, ns_const::MQTT_TOPIC_MAX_LEN);
-        memset((void*)(topic_tx[i]), 0, ns_const::MQTT_TOPIC_MAX_LEN);
-        for (uint8_t ii = 0U; ii < DATA_RX_BUFFER_SIZE; ii++)
-        {   rx_data[i][ii] = 0U;   }
-        num_data_rx[i] = 0U;
+        memset((void*)(topic_cfg[i]), 0, sizeof(topic_cfg[i]));
+        memset((void*)(topic_rx[i]), 0, sizeof(topic_rx[i]));
+        memset((void*)(topic_tx[i]), 0, sizeof(topic_tx[i]));
+        memset((void*)(topic_tx_echo[i]), 0, sizeof(topic_tx_echo[i]));
+        memset((void*)(topic_rec[i]), 0, sizeof(topic_rec[i]));
+        memset((void*)(topic_templates[i]), 0, sizeof(topic_templates[i]));
+        memset((void*)(topic_decoder[i]), 0, sizeof(topic_decoder[i]));
+        decoder[i] = nullptr;
+        rec_gpio_fired[i] = false;
+        tx_ring_memory[i] = nullptr;
+        tx_num_rejected[i] = 0U;
+        t_tcp_start[i] = 0U;
+        tx_echo_data[i] = nullptr;
+        tx_echo_len[i] = 0U;
+        t_tx_echo_start[i] = 0U;
+        rx_memory[i] = nullptr;
+        t_last_rx_us[i] = 0U;
+        t_frame_us[i] = 0;
+        t_prev_byte_us[i] = 0;
+        frame_deltas[i] = nullptr;
+        num_frame_deltas[i] = 0U;
+        rx_record_flags[i] = 0U;
+        pair_data[i] = nullptr;
+        pair_head[i] = 0U;
+        pair_tail[i] = 0U;
+        batch_data[i] = nullptr;
+        batch_len[i] = 0U;
+        t_batch_start[i] = 0U;
+        rx_burst_max[i] = 0U;
+        rx_seq_n[i] = 0U;
+        rx_stream_offset[i] = 0U;
+        rx_num_pub_fail[i] = 0U;
+        dedup_hash[i] = 0U;
+        dedup_len[i] = 0U;
+        dedup_count[i] = 0U;
+        t_dedup_last[i] = 0U;
+        t_dedup_start[i] = 0U;
+        t_dedup_first_us[i] = 0;
+        t_dedup_last_us[i] = 0;
+        dedup_num_suppressed[i] = 0U;
+        rx_pause[i] = false;
+        rx_discard[i] = false;
     }
     msg_status_port_n = 1U;
     t_last_status_sent = 0U;
@@ -111,9 +156,29 @@ void InterfaceUART::init(const char* device_uuid)
     for (uint8_t i = 0U; i < ns_const::MAX_NUM_UART; i++)
     {
         snprintf(topic_cfg[i], sizeof(topic_cfg[i]),
-            MQTT_TOPIC_CFG, device_uuid);
-        snprintf(topic_rx[i], sizeof(topic_rx[i]), MQTT_TOPIC_RX, device_uuid);
-        snprintf(topic_tx[i], sizeof(topic_tx[i]), MQTT_TOPIC_TX, device_uuid);
+            MQTT_TOPIC_CFG, device_uuid, (int)(i));
+        snprintf(topic_rx[i], sizeof(topic_rx[i]),
+            MQTT_TOPIC_RX, device_uuid, (int)(i));
+        snprintf(topic_tx[i], sizeof(topic_tx[i]),
+            MQTT_TOPIC_TX, device_uuid, (int)(i));
+        snprintf(topic_tx_echo[i], sizeof(topic_tx_echo[i]),
+            MQTT_TOPIC_TX_ECHO, device_uuid, (int)(i));
+        snprintf(topic_rec[i], sizeof(topic_rec[i]),
+            MQTT_TOPIC_REC, device_uuid, (int)(i));
+        snprintf(topic_templates[i], sizeof(topic_templates[i]),
+            MQTT_TOPIC_TEMPLATES, device_uuid, (int)(i));
+        snprintf(topic_decoder[i], sizeof(topic_decoder[i]),
+            MQTT_TOPIC_DECODER, device_uuid, (int)(i));
+    }
+
+    // Set framers (the Rx and Tx memory is allocated when each Port is
+    // enabled)
+    for (uint8_t i = 0U; i < ns_const::MAX_NUM_UART; i++)
+    {
+        using namespace ns_device::ns_uart;
+
+        framer[i].set_mode(uart_cfg[i].framing, uart_cfg[i].frame_delimiter,
+            uart_cfg[i].frame_length);
     }
 
     // Init counter for UART Status info MQTT messages send
@@ -132,9 +197,25 @@ void InterfaceUART::process()
     if (initialized == false)
     {   return;   }
 
-    // Handle Serial Ports Message Receptions
+    // Capture data from Poll engine Serial Ports
+    capture_poll();
+
+    // Handle Serial Ports Message Transmissions and Receptions
     for (uint8_t i = 0U; i < ns_const::MAX_NUM_UART; i++)
-    {   handle_uart_rx(i);   }
+    {
+        handle_autobaud(i);
+        handle_overload(i);
+        handle_uart_tcp(i);
+        handle_uart_tx(i);
+        handle_uart_rx(i);
+        handle_recorder(i);
+        if (ns_device::ns_uart::uart_cfg[i].pair_port > i)
+        {   pair_merge(i, false);   }
+        handle_templates(i);
+        handle_decoder(i);
+        handle_dedup_timeout(i);
+        handle_batch_timeout(i);
+    }
 
     // Send current UART status information each second to MQTT
     if (millis() - t_last_status_sent >= T_SEND_STATUS_INFO_MS)
@@ -195,27 +276,621 @@ bool InterfaceUART::configure(const uint8_t uart_n, int argc, char* argv[])
     {   cfg_success = uart_enable(uart_n, false);   }
 
     // UART Port Configure Baudrate
-    else if (strcmp(cmd, "bauds ") == 0)
+    else if (strcmp(cmd, "bauds") == 0)
     {
+        if (argc < 2)
+        {   return false;   }
+
         // Try to convert baudrate argument string to u32
         uint32_t bauds = ns_const::DEFAULT_UART_BAUD_RATE;
-        t_return_code convert_rc = safe_atoi_u32(arg, sizeof(arg), &bauds);
+        t_return_code convert_rc = safe_atoi_u32(arg, strlen(arg), &bauds);
         if (convert_rc != t_return_code::RC_OK)
         {   return false;   }
 
         cfg_success = uart_config_speed(uart_n, bauds);
     }
 
+    // UART Port Automatic Baud Rate Detection
+    else if (strcmp(cmd, "autobaud") == 0)
+    {
+        uint32_t timeout_ms = ns_const::DEFAULT_UART_AUTOBAUD_TIMEOUT_MS;
+        if ( (argc > 1) && (strcmp(arg, "off") == 0) )
+        {   timeout_ms = 0U;   }
+        else if (argc > 1)
+        {
+            t_return_code convert_rc = safe_atoi_u32(arg, strlen(arg),
+                &timeout_ms);
+            if ( (convert_rc != t_return_code::RC_OK) || (timeout_ms == 0U) )
+            {   return false;   }
+        }
+
+        cfg_success = uart_config_autobaud(uart_n, timeout_ms);
+    }
+
+    // UART Port Configure Character Format (i.e. "8N1", "7E1", "8N1.5")
+    else if (strcmp(cmd, "format") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        size_t arg_len = strlen(arg);
+        if ( (arg_len != 3U) && (arg_len != 5U) )
+        {   return false;   }
+
+        // Data bits
+        if ( (arg[0] < '5') || (arg[0] > '8') )
+        {   return false;   }
+        uart_word_length_t data_bits = (uart_word_length_t)(arg[0] - '5');
+
+        // Parity
+        uart_parity_t parity;
+        if ( (arg[1] == 'N') || (arg[1] == 'n') )
+        {   parity = UART_PARITY_DISABLE;   }
+        else if ( (arg[1] == 'E') || (arg[1] == 'e') )
+        {   parity = UART_PARITY_EVEN;   }
+        else if ( (arg[1] == 'O') || (arg[1] == 'o') )
+        {   parity = UART_PARITY_ODD;   }
+        else
+        {   return false;   }
+
+        // Stop bits
+        uart_stop_bits_t stop_bits;
+        if (strcmp(&(arg[2]), "1") == 0)
+        {   stop_bits = UART_STOP_BITS_1;   }
+        else if (strcmp(&(arg[2]), "1.5") == 0)
+        {   stop_bits = UART_STOP_BITS_1_5;   }
+        else if (strcmp(&(arg[2]), "2") == 0)
+        {   stop_bits = UART_STOP_BITS_2;   }
+        else
+        {   return false;   }
+
+        cfg_success = uart_config_format(uart_n, data_bits, parity,
+            stop_bits);
+    }
+
+    // UART Port Configure Rx/Tx GPIOs ("default" for Port default GPIO)
+    else if (strcmp(cmd, "pins") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        int8_t pins[2] = { -1, -1 };
+        for (int i = 1; (i < argc) && (i < 3); i++)
+        {
+            if (strcmp(argv[i], "default") == 0)
+            {   continue;   }
+
+            uint8_t pin = 0U;
+            t_return_code convert_rc = safe_atoi_u8(argv[i],
+                strlen(argv[i]), &pin);
+            if ( (convert_rc != t_return_code::RC_OK) || (pin > INT8_MAX) )
+            {   return false;   }
+            pins[i - 1] = (int8_t)(pin);
+        }
+
+        cfg_success = uart_config_pins(uart_n, pins[0], pins[1]);
+    }
+
+    // UART Port Configure Hardware Flow Control
+    else if (strcmp(cmd, "flow") == 0)
+    {
+        using namespace ns_device::ns_uart;
+
+        if (argc < 2)
+        {   return false;   }
+
+        uart_hw_flowcontrol_t flow_ctrl;
+        if (strcmp(arg, "none") == 0)
+        {   flow_ctrl = UART_HW_FLOWCTRL_DISABLE;   }
+        else if (strcmp(arg, "rts") == 0)
+        {   flow_ctrl = UART_HW_FLOWCTRL_RTS;   }
+        else if (strcmp(arg, "cts") == 0)
+        {   flow_ctrl = UART_HW_FLOWCTRL_CTS;   }
+        else if (strcmp(arg, "rtscts") == 0)
+        {   flow_ctrl = UART_HW_FLOWCTRL_CTS_RTS;   }
+        else
+        {   return false;   }
+
+        // Do nothing if specified UART Port number is invalid
+        if (uart_n >= ns_const::MAX_NUM_UART)
+        {   return false;   }
+
+        // Optional RTS and CTS GPIOs (in that order, as used by the mode)
+        int8_t rts_pin = uart_cfg[uart_n].rts_pin;
+        int8_t cts_pin = uart_cfg[uart_n].cts_pin;
+        int8_t* pins[2] = { &rts_pin, &cts_pin };
+        if (flow_ctrl == UART_HW_FLOWCTRL_CTS)
+        {   pins[0] = &cts_pin;   }
+        for (int i = 2; (i < argc) && (i < 4); i++)
+        {
+            uint8_t pin = 0U;
+            t_return_code convert_rc = safe_atoi_u8(argv[i],
+                strlen(argv[i]), &pin);
+            if ( (convert_rc != t_return_code::RC_OK) || (pin > INT8_MAX) )
+            {   return false;   }
+            *(pins[i - 2]) = (int8_t)(pin);
+        }
+
+        cfg_success = uart_config_flow(uart_n, flow_ctrl, rts_pin, cts_pin);
+    }
+
+    // UART Port Select Capture Profile
+    else if (strcmp(cmd, "profile") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        if (strcmp(arg, "normal") == 0)
+        {   cfg_success = uart_config_profile(uart_n, false);   }
+        else if (strcmp(arg, "highspeed") == 0)
+        {   cfg_success = uart_config_profile(uart_n, true);   }
+        else
+        {   return false;   }
+    }
+
+    // UART Port Configure Rx Data Framing
+    else if (strcmp(cmd, "framing") == 0)
+    {
+        using namespace ns_device::ns_uart;
+
+        if (argc < 2)
+        {   return false;   }
+
+        // Optional framing mode parameter
+        uint32_t param = 0U;
+        if (argc >= 3)
+        {
+            t_return_code convert_rc = safe_atoi_u32(argv[2],
+                strlen(argv[2]), &param);
+            if (convert_rc != t_return_code::RC_OK)
+            {   return false;   }
+        }
+
+        t_uart_framing framing;
+        if (strcmp(arg, "line") == 0)
+        {   framing = t_uart_framing::LINE;   }
+        else if (strcmp(arg, "idle") == 0)
+        {   framing = t_uart_framing::IDLE;   }
+        else if (strcmp(arg, "fixed") == 0)
+        {   framing = t_uart_framing::FIXED;   }
+        else if (strcmp(arg, "cobs") == 0)
+        {   framing = t_uart_framing::COBS;   }
+        else if (strcmp(arg, "slip") == 0)
+        {   framing = t_uart_framing::SLIP;   }
+        else
+        {   return false;   }
+
+        cfg_success = uart_config_framing(uart_n, framing, param);
+    }
+
+    // UART Port Configure Rx Frames Batching
+    else if (strcmp(cmd, "batch") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        uint32_t size = 0U;
+        uint32_t ms = DEFAULT_BATCH_MS;
+        if (strcmp(arg, "off") != 0)
+        {
+            t_return_code convert_rc = safe_atoi_u32(arg, strlen(arg), &size);
+            if (convert_rc != t_return_code::RC_OK)
+            {   return false;   }
+            if (argc >= 3)
+            {
+                convert_rc = safe_atoi_u32(argv[2], strlen(argv[2]), &ms);
+                if (convert_rc != t_return_code::RC_OK)
+                {   return false;   }
+            }
+        }
+
+        cfg_success = uart_config_batch(uart_n, size, ms);
+    }
+
+    // UART Port Configure Rx Buffer Size
+    else if (strcmp(cmd, "rxbuf") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        if (strcmp(arg, "auto") == 0)
+        {
+            uint32_t stall_ms = ns_const::DEFAULT_UART_RX_STALL_MS;
+            if (argc > 2)
+            {
+                t_return_code convert_rc = safe_atoi_u32(argv[2],
+                    strlen(argv[2]), &stall_ms);
+                if (convert_rc != t_return_code::RC_OK)
+                {   return false;   }
+            }
+            cfg_success = uart_config_rx_buffer_auto(uart_n, stall_ms);
+        }
+        else
+        {
+            uint32_t size = 0U;
+            t_return_code convert_rc = safe_atoi_u32(arg, strlen(arg), &size);
+            if (convert_rc != t_return_code::RC_OK)
+            {   return false;   }
+
+            cfg_success = uart_config_rx_buffer(uart_n, size);
+        }
+    }
+
+    // UART Port Configure Rx Frames Timestamping
+    else if (strcmp(cmd, "timestamps") == 0)
+    {
+        using namespace ns_device::ns_uart;
+
+        if (argc < 2)
+        {   return false;   }
+
+        t_uart_timestamps mode;
+        if (strcmp(arg, "off") == 0)
+        {   mode = t_uart_timestamps::OFF;   }
+        else if (strcmp(arg, "on") == 0)
+        {   mode = t_uart_timestamps::ON;   }
+        else if (strcmp(arg, "deltas") == 0)
+        {   mode = t_uart_timestamps::DELTAS;   }
+        else
+        {   return false;   }
+
+        cfg_success = uart_config_timestamps(uart_n, mode);
+    }
+
+    // UART Port Configure Line Events Publication
+    else if (strcmp(cmd, "events") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        if (strcmp(arg, "on") == 0)
+        {   cfg_success = uart_config_line_events(uart_n, true);   }
+        else if (strcmp(arg, "off") == 0)
+        {   cfg_success = uart_config_line_events(uart_n, false);   }
+        else
+        {   return false;   }
+    }
+
+    // UART Port Configure Rx Messages Sequence Header
+    else if (strcmp(cmd, "seq") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        if (strcmp(arg, "on") == 0)
+        {   cfg_success = uart_config_seq(uart_n, true);   }
+        else if (strcmp(arg, "off") == 0)
+        {   cfg_success = uart_config_seq(uart_n, false);   }
+        else
+        {   return false;   }
+    }
+
+    // UART Port Configure Rx Frames Filter
+    else if (strcmp(cmd, "filter") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        if (strcmp(arg, "clear") == 0)
+        {   return uart_config_filter_clear(uart_n);   }
+
+        UARTFilter::t_rule rule;
+        if (strcmp(arg, "include") == 0)
+        {   rule = UARTFilter::t_rule::INCLUDE;   }
+        else if (strcmp(arg, "exclude") == 0)
+        {   rule = UARTFilter::t_rule::EXCLUDE;   }
+        else
+        {   return false;   }
+        if (argc < 3)
+        {   return false;   }
+
+        // The pattern can contain spaces
+        char pattern[UARTFilter::MAX_PATTERN_LEN + 3U];
+        if (args_join(argc, argv, 2, pattern, sizeof(pattern)) == false)
+        {   return false;   }
+
+        cfg_success = uart_config_filter_add(uart_n, rule, pattern);
+    }
+
+    // UART Port Flight Recorder
+    else if (strcmp(cmd, "rec") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        if (strcmp(arg, "off") == 0)
+        {   cfg_success = uart_config_recorder(uart_n, 0U, 0U);   }
+        else if (strcmp(arg, "trigger") == 0)
+        {   cfg_success = uart_recorder_trigger(uart_n);   }
+        else if (strcmp(arg, "match") == 0)
+        {
+            if (argc < 3)
+            {   return false;   }
+            if (strcmp(argv[2], "clear") == 0)
+            {   return uart_config_recorder_match(uart_n, nullptr);   }
+
+            // The pattern can contain spaces
+            char pattern[UARTFilter::MAX_PATTERN_LEN + 3U];
+            if (args_join(argc, argv, 2, pattern, sizeof(pattern)) == false)
+            {   return false;   }
+            cfg_success = uart_config_recorder_match(uart_n, pattern);
+        }
+        else if (strcmp(arg, "gpio") == 0)
+        {
+            if (argc < 3)
+            {   return false;   }
+            if (strcmp(argv[2], "off") == 0)
+            {   return uart_config_recorder_gpio(uart_n, -1, 0U);   }
+
+            uint8_t gpio = 0U;
+            t_return_code convert_rc = safe_atoi_u8(argv[2],
+                strlen(argv[2]), &gpio);
+            if ( (convert_rc != t_return_code::RC_OK) || (gpio > INT8_MAX) )
+            {   return false;   }
+
+            uint8_t mode = RISING;
+            if (argc > 3)
+            {
+                if (strcmp(argv[3], "rising") == 0)
+                {   mode = RISING;   }
+                else if (strcmp(argv[3], "falling") == 0)
+                {   mode = FALLING;   }
+                else if (strcmp(argv[3], "change") == 0)
+                {   mode = CHANGE;   }
+                else
+                {   return false;   }
+            }
+
+            cfg_success = uart_config_recorder_gpio(uart_n, (int8_t)(gpio),
+                mode);
+        }
+        else
+        {
+            // History size and optional post-trigger window (KB)
+            uint32_t size_kb = 0U;
+            t_return_code convert_rc = safe_atoi_u32(arg, strlen(arg),
+                &size_kb);
+            if (convert_rc != t_return_code::RC_OK)
+            {   return false;   }
+
+            uint32_t post_kb = size_kb / 2U;
+            if (argc > 2)
+            {
+                convert_rc = safe_atoi_u32(argv[2], strlen(argv[2]),
+                    &post_kb);
+                if (convert_rc != t_return_code::RC_OK)
+                {   return false;   }
+            }
+
+            // Check the sizes before converting them to bytes (overflow)
+            if ( (size_kb > (ns_const::MAX_UART_REC_SIZE / 1024U)) ||
+                 (post_kb > (ns_const::MAX_UART_REC_SIZE / 1024U)) )
+            {   return false;   }
+
+            cfg_success = uart_config_recorder(uart_n, size_kb * 1024U,
+                post_kb * 1024U);
+        }
+    }
+
+    // UART Port Configure Rx Log Lines Template Encoding
+    else if (strcmp(cmd, "templates") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        if (strcmp(arg, "on") == 0)
+        {   cfg_success = uart_config_templates(uart_n, true);   }
+        else if (strcmp(arg, "off") == 0)
+        {   cfg_success = uart_config_templates(uart_n, false);   }
+        else
+        {   return false;   }
+    }
+
+    // UART Port Configure Rx Messages Compression
+    else if (strcmp(cmd, "compress") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        if (strcmp(arg, "on") == 0)
+        {   cfg_success = uart_config_compress(uart_n, true);   }
+        else if (strcmp(arg, "off") == 0)
+        {   cfg_success = uart_config_compress(uart_n, false);   }
+        else
+        {   return false;   }
+    }
+
+    // UART Port Configure Protocol Decoder
+    else if (strcmp(cmd, "decoder") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        cfg_success = uart_config_decoder(uart_n, argc - 1, &(argv[1]));
+    }
+
+    // UART Port Configure Repeated Frames Collapsing
+    else if (strcmp(cmd, "dedup") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        uint32_t window_ms = 0U;
+        if (strcmp(arg, "off") != 0)
+        {
+            t_return_code convert_rc = safe_atoi_u32(arg, strlen(arg),
+                &window_ms);
+            if ( (convert_rc != t_return_code::RC_OK) || (window_ms == 0U) )
+            {   return false;   }
+        }
+
+        cfg_success = uart_config_dedup(uart_n, window_ms);
+    }
+
+    // UART Port Configure Rx Overload Policy
+    else if (strcmp(cmd, "overload") == 0)
+    {
+        using namespace ns_device::ns_uart;
+
+        if (argc < 2)
+        {   return false;   }
+
+        t_uart_overload policy;
+        if (strcmp(arg, "off") == 0)
+        {   policy = t_uart_overload::OFF;   }
+        else if (strcmp(arg, "oldest") == 0)
+        {   policy = t_uart_overload::DROP_OLDEST;   }
+        else if (strcmp(arg, "newest") == 0)
+        {   policy = t_uart_overload::DROP_NEWEST;   }
+        else if (strcmp(arg, "summary") == 0)
+        {   policy = t_uart_overload::SUMMARY;   }
+        else if (strcmp(arg, "pause") == 0)
+        {   policy = t_uart_overload::PAUSE;   }
+        else
+        {   return false;   }
+
+        cfg_success = uart_config_overload(uart_n, policy);
+    }
+
+    // UART Port Configure Tx Queue Size
+    else if (strcmp(cmd, "txbuf") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        uint32_t size = 0U;
+        t_return_code convert_rc = safe_atoi_u32(arg, strlen(arg), &size);
+        if (convert_rc != t_return_code::RC_OK)
+        {   return false;   }
+
+        cfg_success = uart_config_tx_buffer(uart_n, size);
+    }
+
+    // UART Port Configure Tx Messages Echo
+    else if (strcmp(cmd, "txecho") == 0)
+    {
+        using namespace ns_device::ns_uart;
+
+        if (argc < 2)
+        {   return false;   }
+
+        t_uart_tx_echo mode;
+        if (strcmp(arg, "off") == 0)
+        {   mode = t_uart_tx_echo::OFF;   }
+        else if (strcmp(arg, "on") == 0)
+        {   mode = t_uart_tx_echo::ON;   }
+        else if (strcmp(arg, "batch") == 0)
+        {   mode = t_uart_tx_echo::BATCH;   }
+        else
+        {   return false;   }
+
+        cfg_success = uart_config_tx_echo(uart_n, mode);
+    }
+
+    // Tx rejection notification published by the device itself
+    else if (strcmp(cmd, "nack") == 0)
+    {   return false;   }
+
+    // UART Port Pair for Full-Duplex Sniffing
+    else if (strcmp(cmd, "pair") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        uint8_t pair_n = 0U;
+        uint32_t window_ms = DEFAULT_PAIR_WINDOW_MS;
+        if (strcmp(arg, "off") != 0)
+        {
+            t_return_code convert_rc = safe_atoi_u8(arg, strlen(arg),
+                &pair_n);
+            if ( (convert_rc != t_return_code::RC_OK) || (pair_n == 0U) )
+            {   return false;   }
+            if (argc >= 3)
+            {
+                convert_rc = safe_atoi_u32(argv[2], strlen(argv[2]),
+                    &window_ms);
+                if (convert_rc != t_return_code::RC_OK)
+                {   return false;   }
+            }
+        }
+
+        cfg_success = uart_config_pair(uart_n, pair_n, window_ms);
+    }
+
+    // UART Port Bridge for Man-In-The-Middle Logging
+    else if (strcmp(cmd, "bridge") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        uint8_t bridge_n = 0U;
+        if (strcmp(arg, "off") != 0)
+        {
+            t_return_code convert_rc = safe_atoi_u8(arg, strlen(arg),
+                &bridge_n);
+            if ( (convert_rc != t_return_code::RC_OK) || (bridge_n == 0U) )
+            {   return false;   }
+        }
+
+        cfg_success = uart_config_bridge(uart_n, bridge_n);
+    }
+
+    // UART Port Raw TCP Serial Server
+    else if (strcmp(cmd, "tcp") == 0)
+    {
+        if (argc < 2)
+        {   return false;   }
+
+        uint32_t tcp_port = 0U;
+        if (strcmp(arg, "off") != 0)
+        {
+            t_return_code convert_rc = safe_atoi_u32(arg, strlen(arg),
+                &tcp_port);
+            if ( (convert_rc != t_return_code::RC_OK) || (tcp_port == 0U) ||
+                 (tcp_port > UINT16_MAX) )
+            {   return false;   }
+        }
+
+        cfg_success = uart_config_tcp(uart_n, (uint16_t)(tcp_port));
+    }
+
+    // UART Port Configure Capture Engine
+    else if (strcmp(cmd, "engine") == 0)
+    {
+        using namespace ns_device::ns_uart;
+
+        if (argc < 2)
+        {   return false;   }
+
+        if (strcmp(arg, "poll") == 0)
+        {   cfg_success = uart_config_engine(uart_n, t_uart_engine::POLL);   }
+        else if (strcmp(arg, "event") == 0)
+        {   cfg_success = uart_config_engine(uart_n, t_uart_engine::EVENT);   }
+        else
+        {   return false;   }
+    }
+
     // Unknown/Unexpected config
     else
     {   return false;   }
 
+    // Allocate the buffers of the features configured for the enabled Ports
+    // and release the ones of the features turned off (a command can change
+    // the features of both Ports of a pair)
+    for (uint8_t i = 0U; i < ns_const::MAX_NUM_UART; i++)
+    {
+        if ( ns_device::ns_uart::uart_cfg[i].enable &&
+             (port_memory_alloc(i) == false) )
+        {   cfg_success = false;   }
+    }
+
     return cfg_success;
 }
 
 /**
  * @details This function is a setter to configure an UART Port speed by
- * modifying the value of the Global uart_cfg bauds field.
+ * modifying the value of the Global uart_cfg bauds field, then the Port is
+ * restarted to apply it (if enabled).
  */
 bool InterfaceUART::uart_config_speed(const uint8_t uart_n,
         const uint32_t bauds)
@@ -232,16 +907,29 @@ bool InterfaceUART::uart_config_speed(const uint8_t uart_n,
     if (uart_n >= ns_const::MAX_NUM_UART)
     {   return false;   }
 
+    // Do nothing if the speed is out of the UART hardware range
+    if ( (bauds < ns_const::MIN_UART_BAUD_RATE) ||
+         (bauds > ns_const::MAX_UART_BAUD_RATE) )
+    {   return false;   }
+
+    // A configured speed ends the detection in progress
+    if (autobaud[uart_n].get_state() == UARTAutobaud::t_state::DETECTING)
+    {   autobaud[uart_n].stop();   }
+
     ns_device::ns_uart::uart_cfg[uart_n].bauds = bauds;
+    ns_device::ns_uart::uart_cfg[uart_n].config.baud_rate = (int)(bauds);
 
-    return true;
+    return capture_restart(uart_n);
 }
 
 /**
- * @details This function is a setter to enable or disable an UART Port by
- * modifying the value of the Global uart_cfg enable field.
+ * @details This function starts the automatic baud rate detection of an
+ * UART Port (the Port must be enabled, so its UART has the Rx pin). Any
+ * pending batch is published first, as the frames received until the speed
+ * is detected are dropped.
  */
-bool InterfaceUART::uart_enable(const uint8_t uart_n, const bool enable)
+bool InterfaceUART::uart_config_autobaud(const uint8_t uart_n,
+        const uint32_t timeout_ms)
 {
     // Do nothing if component was not initialized
     if (initialized == false)
@@ -255,18 +943,35 @@ bool InterfaceUART::uart_enable(const uint8_t uart_n, const bool enable)
     if (uart_n >= ns_const::MAX_NUM_UART)
     {   return false;   }
 
-    ns_device::ns_uart::uart_cfg[uart_n].enable = enable;
+    // Stop the detection
+    if (timeout_ms == 0U)
+    {
+        autobaud[uart_n].stop();
+        return true;
+    }
+
+    // Do nothing if the timeout is out of range
+    if (timeout_ms > UARTAutobaud::MAX_TIMEOUT_MS)
+    {   return false;   }
+
+    // Do nothing if the Port is not enabled
+    if (ns_device::ns_uart::uart_cfg[uart_n].enable == false)
+    {   return false;   }
+
+    batch_flush(uart_n);
+    autobaud[uart_n].start((uart_port_t)(uart_n), timeout_ms);
 
     return true;
 }
 
 /**
- * @details This function checks that the provided UART Port number is valid
- * and has been enabled, then it echoe the message to Transmitt by the UART
- * trhrough the MQTT Tx topic to acknowledge it transmission, at the end, the
- * message is transmitted through the corresponding UART port.
+ * @details This function is a setter to configure an UART Port character
+ * format by modifying the values of the Global uart_cfg config fields, then
+ * the Port is restarted to apply it (if enabled).
  */
-bool InterfaceUART::uart_tx_msg(const uint8_t uart_n, const char* msg)
+bool InterfaceUART::uart_config_format(const uint8_t uart_n,
+        const uart_word_length_t data_bits, const uart_parity_t parity,
+        const uart_stop_bits_t stop_bits)
 {
     // Do nothing if component was not initialized
     if (initialized == false)
@@ -280,25 +985,21 @@ bool InterfaceUART::uart_tx_msg(const uint8_t uart_n, const char* msg)
     if (uart_n >= ns_const::MAX_NUM_UART)
     {   return false;   }
 
-    // Do nothing if the UART Port was not enabled
-    if (ns_device::ns_uart::uart_cfg[uart_n].enable == false)
-    {   return false;   }
-
-    // Transmit the message through the UART Port
-    SerialPort[uart_n]->write(msg);
-
-    // Publish to MQTT to notify transmission
-    mqtt_publish_tx(uart_n, msg);
+    uart_config_t* config = &(ns_device::ns_uart::uart_cfg[uart_n].config);
+    config->data_bits = data_bits;
+    config->parity = parity;
+    config->stop_bits = stop_bits;
 
-    return true;
+    return capture_restart(uart_n);
 }
 
 /**
- * @details This function checks that the provided UART Port number is valid
- * and has been enabled, then it send each of the messages from the provided
- * argument list through the UART port.
+ * @details This function is a setter to configure the Rx and Tx GPIOs of an
+ * UART Port by modifying the values of the Global uart_cfg pin fields, then
+ * the Port is restarted to apply them (if enabled).
  */
-bool InterfaceUART::uart_tx_msg(const uint8_t uart_n, int argc, char* argv[])
+bool InterfaceUART::uart_config_pins(const uint8_t uart_n,
+        const int8_t rx_pin, const int8_t tx_pin)
 {
     // Do nothing if component was not initialized
     if (initialized == false)
@@ -312,34 +1013,29 @@ bool InterfaceUART::uart_tx_msg(const uint8_t uart_n, int argc, char* argv[])
     if (uart_n >= ns_const::MAX_NUM_UART)
     {   return false;   }
 
-    // Do nothing if the UART Port was not enabled
-    if (ns_device::ns_uart::uart_cfg[uart_n].enable == false)
+    // Do nothing if any GPIO doesn't exist
+    if ( (rx_pin >= SOC_GPIO_PIN_COUNT) || (tx_pin >= SOC_GPIO_PIN_COUNT) )
     {   return false;   }
 
-    // Transmit the message through the UART Port
-    for (int i = 0; i < argc; i++)
-    {   SerialPort[uart_n]->write(argv[i]);   }
-
-    // Publish to MQTT to notify transmission
-    char msg_tx[DATA_RX_BUFFER_SIZE];
-    msg_tx[0] = '\0';
-    if (single_str_from_array_of_str(argc, argv, msg_tx, DATA_RX_BUFFER_SIZE))
-    {   mqtt_publish_tx(uart_n, msg_tx);   }
+    ns_device::ns_uart::uart_cfg[uart_n].rx_pin = rx_pin;
+    ns_device::ns_uart::uart_cfg[uart_n].tx_pin = tx_pin;
 
-    return true;
+    return capture_restart(uart_n);
 }
 
-/*****************************************************************************/
-
-/* Private Methods */
-
 /**
- * @details Checks if the UART is enabled and configured, then checks if there
- * is any message received through this port and forward it through MQTT.
+ * @details This function is a setter to configure the hardware flow control
+ * of an UART Port by modifying the values of the Global uart_cfg config and
+ * RTS/CTS pin fields, then the Port is restarted to apply it (if enabled).
+ * The GPIOs required by the flow control mode must be provided.
  */
-bool InterfaceUART::handle_uart_rx(const uint8_t uart_n)
+bool InterfaceUART::uart_config_flow(const uint8_t uart_n,
+        const uart_hw_flowcontrol_t flow_ctrl, const int8_t rts_pin,
+        const int8_t cts_pin)
 {
-    bool msg_published = false;
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
 
     // Do nothing for UART0 that is used as device CLI
     if (uart_n == 0U)
@@ -349,70 +1045,3237 @@ bool InterfaceUART::handle_uart_rx(const uint8_t uart_n)
     if (uart_n >= ns_const::MAX_NUM_UART)
     {   return false;   }
 
-    // Do nothing if the UART Port was not enabled
-    if (ns_device::ns_uart::uart_cfg[uart_n].enable == false)
+    // Do nothing if any GPIO doesn't exist
+    if ( (rts_pin >= SOC_GPIO_PIN_COUNT) || (cts_pin >= SOC_GPIO_PIN_COUNT) )
     {   return false;   }
 
-    // Do nothing if there is none UART data received
-    if (SerialPort[uart_n]->available() == 0)
+    // Do nothing if a GPIO required by the flow control mode is missing
+    bool use_rts = ( (flow_ctrl == UART_HW_FLOWCTRL_RTS) ||
+                     (flow_ctrl == UART_HW_FLOWCTRL_CTS_RTS) );
+    bool use_cts = ( (flow_ctrl == UART_HW_FLOWCTRL_CTS) ||
+                     (flow_ctrl == UART_HW_FLOWCTRL_CTS_RTS) );
+    if ( (use_rts && (rts_pin < 0)) || (use_cts && (cts_pin < 0)) )
     {   return false;   }
 
-    // Handle UART data reception
-    uint8_t* ptr_rx_data = rx_data[uart_n];
-    uint32_t* ptr_num_data_rx = &(num_data_rx[uart_n]);
-
-    // Read received byte
-    ptr_rx_data[*ptr_num_data_rx] = SerialPort[uart_n]->read();
-    *ptr_num_data_rx = *ptr_num_data_rx + 1U;
-
-    // Send MQTT message if received byte is an End Of Line
-    if (ptr_rx_data[*ptr_num_data_rx - 1U] == '\n')
-    {
-        ptr_rx_data[*ptr_num_data_rx - 1U] = (uint8_t)('\0');
-        msg_published = mqtt_publish_rx(uart_n, (const char*)(ptr_rx_data));
-        *ptr_num_data_rx = 0U;
-    }
-
-    // Send MQTT message if buffer is completed
-    else if (*ptr_num_data_rx == DATA_RX_BUFFER_SIZE - 1U)
-    {
-        ptr_rx_data[DATA_RX_BUFFER_SIZE - 1U] = (uint8_t)('\0');
-        msg_published = mqtt_publish_rx(uart_n, (const char*)(ptr_rx_data));
-        *ptr_num_data_rx = 0U;
-    }
+    ns_device::ns_uart::uart_cfg[uart_n].config.flow_ctrl = flow_ctrl;
+    ns_device::ns_uart::uart_cfg[uart_n].rts_pin = rts_pin;
+    ns_device::ns_uart::uart_cfg[uart_n].cts_pin = cts_pin;
 
-    return msg_published;
+    return capture_restart(uart_n);
 }
 
 /**
- * @details This function prepare a JSON string with the current
- * "msg_status_port_n" UART Port status information and send it.
- * It also update the "msg_status_port_n" variable to send next UART Port
- * information the next time this function is call.
- *
- * UART Status Information JSON Message Format:
+ * @details This function is a setter to select the capture profile of an
+ * UART Port by modifying the value of the Global uart_cfg high_speed field,
+ * then the Port is restarted to apply it (if enabled).
+ */
+bool InterfaceUART::uart_config_profile(const uint8_t uart_n,
+        const bool high_speed)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    ns_device::ns_uart::uart_cfg[uart_n].high_speed = high_speed;
+
+    return capture_restart(uart_n);
+}
+
+/**
+ * @details This function is a setter to configure the Rx data framing of an
+ * UART Port by modifying the values of the Global uart_cfg framing fields,
+ * then it applies the new mode to the Port framer (any partial frame is
+ * discarded) and the UART hardware Rx timeout. The framing of a Port with a
+ * decoder is the one that the decoder requires, so it can't be changed.
+ */
+bool InterfaceUART::uart_config_framing(const uint8_t uart_n,
+        const ns_device::ns_uart::t_uart_framing framing, uint32_t param)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if the Port has a decoder (it sets the framing)
+    if (uart_cfg[uart_n].decoder != 0U)
+    {   return false;   }
+
+    // Check framing mode parameter
+    s_uart_config* cfg = &(uart_cfg[uart_n]);
+    if (framing == t_uart_framing::LINE)
+    {
+        if (param == 0U)
+        {   param = (uint32_t)('\n');   }
+        if (param > UINT8_MAX)
+        {   return false;   }
+        cfg->frame_delimiter = (uint8_t)(param);
+    }
+    else if (framing == t_uart_framing::IDLE)
+    {
+        if (param == 0U)
+        {   param = 4U;   }
+        if (param > MAX_FRAME_IDLE_CHARS)
+        {   return false;   }
+        cfg->frame_idle_chars = (uint8_t)(param);
+    }
+    else if (framing == t_uart_framing::FIXED)
+    {
+        if ( (param == 0U) || (param > DATA_RX_BUFFER_SIZE - 1U) )
+        {   return false;   }
+        cfg->frame_length = (uint16_t)(param);
+    }
+    cfg->framing = framing;
+
+    framer[uart_n].set_mode(cfg->framing, cfg->frame_delimiter,
+        cfg->frame_length);
+    apply_rx_timeout(uart_n);
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to configure the Rx frames batching of
+ * an UART Port by modifying the values of the Global uart_cfg batch fields.
+ * Any pending batch is published before applying the new configuration.
+ */
+bool InterfaceUART::uart_config_batch(const uint8_t uart_n,
+        const uint32_t size, const uint32_t ms)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Check for valid batch limits
+    if (size != 0U)
+    {
+        if ( (size < MIN_BATCH_SIZE) || (size > MAX_BATCH_SIZE) )
+        {   return false;   }
+        if ( (ms == 0U) || (ms > UINT16_MAX) )
+        {   return false;   }
+    }
+
+    batch_flush(uart_n);
+    ns_device::ns_uart::uart_cfg[uart_n].batch_size = (uint16_t)(size);
+    ns_device::ns_uart::uart_cfg[uart_n].batch_ms = (uint16_t)(ms);
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to configure the Rx ring buffer size of
+ * an UART Port by modifying the value of the Global uart_cfg rx_buffer_size
+ * field. The size is rounded up to the next power of two. The capture of the
+ * Port is restarted to reallocate the ring buffer (if enabled).
+ */
+bool InterfaceUART::uart_config_rx_buffer(const uint8_t uart_n, uint32_t size)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if requested size is out of range
+    if (size > ns_const::MAX_UART_RX_BUFFER_SIZE)
+    {   return false;   }
+
+    // Round up the size to a power of two
+    uint32_t ring_size = ns_const::MIN_UART_RX_BUFFER_SIZE;
+    while (ring_size < size)
+    {   ring_size = ring_size << 1U;   }
+
+    ns_device::ns_uart::uart_cfg[uart_n].rx_buffer_size = ring_size;
+
+    return capture_restart(uart_n);
+}
+
+/**
+ * @details This function is a setter to configure the Rx ring buffer size of
+ * an UART Port to be derived from its speed, by modifying the values of the
+ * Global uart_cfg rx_buffer_size (0) and rx_stall_ms fields. The capture of
+ * the Port is restarted to reallocate the ring buffer and the UART Driver Rx
+ * buffer (if enabled).
+ */
+bool InterfaceUART::uart_config_rx_buffer_auto(const uint8_t uart_n,
+        const uint32_t stall_ms)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if requested stall time is out of range
+    if ( (stall_ms == 0U) || (stall_ms > ns_const::MAX_UART_RX_STALL_MS) )
+    {   return false;   }
+
+    ns_device::ns_uart::uart_cfg[uart_n].rx_buffer_size = 0U;
+    ns_device::ns_uart::uart_cfg[uart_n].rx_stall_ms = (uint16_t)(stall_ms);
+
+    return capture_restart(uart_n);
+}
+
+/**
+ * @details This function is a setter to configure the Tx queue size of an
+ * UART Port by modifying the value of the Global uart_cfg tx_buffer_size
+ * field. The size is rounded up to the next power of two. The capture of the
+ * Port is restarted to reallocate the queue (if enabled, pending Tx data is
+ * discarded).
+ */
+bool InterfaceUART::uart_config_tx_buffer(const uint8_t uart_n, uint32_t size)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if requested size is out of range
+    if (size > ns_const::MAX_UART_TX_BUFFER_SIZE)
+    {   return false;   }
+
+    // Round up the size to a power of two
+    uint32_t queue_size = ns_const::MIN_UART_TX_BUFFER_SIZE;
+    while (queue_size < size)
+    {   queue_size = queue_size << 1U;   }
+
+    ns_device::ns_uart::uart_cfg[uart_n].tx_buffer_size = queue_size;
+
+    return capture_restart(uart_n);
+}
+
+/**
+ * @details This function is a setter to configure the Tx messages echo of an
+ * UART Port by modifying the value of the Global uart_cfg tx_echo field. Any
+ * pending echo is published before applying the new mode.
+ */
+bool InterfaceUART::uart_config_tx_echo(const uint8_t uart_n,
+        const ns_device::ns_uart::t_uart_tx_echo mode)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    tx_echo_flush(uart_n);
+    ns_device::ns_uart::uart_cfg[uart_n].tx_echo = mode;
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to configure the in-band line events of
+ * an UART Port by modifying the value of the Global uart_cfg line_events
+ * field. The events are published as timestamped records, so timestamps are
+ * enabled if they were off.
+ */
+bool InterfaceUART::uart_config_line_events(const uint8_t uart_n,
+        const bool enable)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    if ( enable && (uart_cfg[uart_n].timestamps == t_uart_timestamps::OFF) )
+    {
+        batch_flush(uart_n);
+        uart_cfg[uart_n].timestamps = t_uart_timestamps::ON;
+    }
+    uart_cfg[uart_n].line_events = enable;
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to configure the Rx messages sequence
+ * header of an UART Port by modifying the value of the Global uart_cfg rx_seq
+ * field. Any pending batch is published before applying it, so a batch is
+ * never published with a header it wasn't accounted for.
+ */
+bool InterfaceUART::uart_config_seq(const uint8_t uart_n, const bool enable)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    batch_flush(uart_n);
+    ns_device::ns_uart::uart_cfg[uart_n].rx_seq = enable;
+
+    return true;
+}
+
+/**
+ * @details This function adds a pattern to the Rx frames filter of an UART
+ * Port, recompiling its automaton.
+ */
+bool InterfaceUART::uart_config_filter_add(const uint8_t uart_n,
+        const UARTFilter::t_rule rule, const char* pattern)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if there is no pattern
+    if (pattern == nullptr)
+    {   return false;   }
+
+    return rx_filter[uart_n].add(rule, pattern, strlen(pattern));
+}
+
+/**
+ * @details This function removes all the patterns of the Rx frames filter of
+ * an UART Port.
+ */
+bool InterfaceUART::uart_config_filter_clear(const uint8_t uart_n)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    rx_filter[uart_n].clear();
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to configure the flight recorder of an
+ * UART Port by modifying the values of the Global uart_cfg rec fields, then
+ * the recorder history buffer is (re)allocated. Any pending batch is
+ * published first, as the frames are not published anymore while recording.
+ */
+bool InterfaceUART::uart_config_recorder(const uint8_t uart_n,
+        const uint32_t size, const uint32_t post_size)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if the sizes are out of range
+    if ( (size != 0U) &&
+         ( (size < ns_const::MIN_UART_REC_SIZE) ||
+           (size > ns_const::MAX_UART_REC_SIZE) || (post_size > size) ) )
+    {   return false;   }
+
+    batch_flush(uart_n);
+    if (recorder[uart_n].configure(size, post_size) == false)
+    {
+        uart_cfg[uart_n].rec_size = 0U;
+        uart_cfg[uart_n].rec_post_size = 0U;
+        return false;
+    }
+    uart_cfg[uart_n].rec_size = size;
+    uart_cfg[uart_n].rec_post_size = post_size;
+
+    return true;
+}
+
+/**
+ * @details This function adds a pattern to the flight recorder trigger
+ * patterns of an UART Port, or removes all of them.
+ */
+bool InterfaceUART::uart_config_recorder_match(const uint8_t uart_n,
+        const char* pattern)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    if (pattern == nullptr)
+    {
+        rec_match[uart_n].clear();
+        return true;
+    }
+
+    return rec_match[uart_n].add(UARTFilter::t_rule::INCLUDE, pattern,
+        strlen(pattern));
+}
+
+/**
+ * @details This function is a setter to configure the flight recorder GPIO
+ * trigger of an UART Port by modifying the values of the Global uart_cfg
+ * rec_gpio fields. The interrupt of the previous GPIO is detached and the new
+ * GPIO is configured as input with an edge interrupt that flags the trigger
+ * (fired from process()).
+ */
+bool InterfaceUART::uart_config_recorder_gpio(const uint8_t uart_n,
+        const int8_t gpio, const uint8_t mode)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if the GPIO is invalid
+    if (gpio >= SOC_GPIO_PIN_COUNT)
+    {   return false;   }
+
+    if (uart_cfg[uart_n].rec_gpio >= 0)
+    {   detachInterrupt((uint8_t)(uart_cfg[uart_n].rec_gpio));   }
+    uart_cfg[uart_n].rec_gpio = -1;
+    rec_gpio_fired[uart_n] = false;
+
+    // Remove GPIO trigger request
+    if (gpio < 0)
+    {   return true;   }
+
+    pinMode((uint8_t)(gpio), INPUT);
+    attachInterruptArg((uint8_t)(gpio), rec_gpio_isr,
+        (void*)(&(rec_gpio_fired[uart_n])), (int)(mode));
+    uart_cfg[uart_n].rec_gpio = gpio;
+    uart_cfg[uart_n].rec_gpio_mode = mode;
+
+    return true;
+}
+
+/**
+ * @details This function fires the flight recorder trigger of an UART Port.
+ */
+bool InterfaceUART::uart_recorder_trigger(const uint8_t uart_n)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    return recorder[uart_n].trigger();
+}
+
+/**
+ * @details This function is a setter to configure the Rx log lines template
+ * encoding of an UART Port by modifying the value of the Global uart_cfg
+ * templates field. Any pending batch is published before applying it (the
+ * encoded lines change the batch boundaries), and the templates are learned
+ * again from scratch (the empty set is published to replace the retained
+ * one). The templates table is allocated when the Port is enabled, and
+ * released when it is disabled.
+ */
+bool InterfaceUART::uart_config_templates(const uint8_t uart_n,
+        const bool enable)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    batch_flush(uart_n);
+    ns_device::ns_uart::uart_cfg[uart_n].templates = enable;
+
+    // The templates table is only allocated while the Port is enabled
+    bool configured = true;
+    if ( (enable == false) || ns_device::ns_uart::uart_cfg[uart_n].enable )
+    {   configured = rx_templates[uart_n].configure(enable);   }
+    if (configured == false)
+    {   ns_device::ns_uart::uart_cfg[uart_n].templates = false;   }
+    handle_templates(uart_n);
+
+    return configured;
+}
+
+/**
+ * @details This function is a setter to configure the Rx messages
+ * compression of an UART Port by modifying the value of the Global uart_cfg
+ * compress field. Any pending batch is published before applying it, and
+ * the compression window is emptied so the first compressed message can be
+ * decoded on its own.
+ */
+bool InterfaceUART::uart_config_compress(const uint8_t uart_n,
+        const bool enable)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    batch_flush(uart_n);
+    compressor[uart_n].reset();
+    ns_device::ns_uart::uart_cfg[uart_n].compress = enable;
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to configure the protocol decoder of an
+ * UART Port by modifying the value of the Global uart_cfg decoder field.
+ * The new decoder options and framing are validated first on a temporary
+ * decoder, so the active decoder is kept if they are invalid. Then the
+ * active decoder is flushed and destroyed, the new one is built in the Port
+ * decoder storage, and it sets the framing that it requires and the
+ * timestamps if it needs them. Any pending batch is published first so raw
+ * frames and records are never mixed. Removing the decoder keeps the framing
+ * and timestamps that it set.
+ */
+bool InterfaceUART::uart_config_decoder(const uint8_t uart_n, int argc,
+        char* argv[])
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if there is no decoder name
+    if (argc < 1)
+    {   return false;   }
+
+    // Decoder not included in the Firmware or unknown
+    uint8_t decoder_id = 0U;
+    if (strcmp(argv[0], "off") != 0)
+    {
+        decoder_id = UARTDecoders::find(argv[0]);
+        if (decoder_id == 0U)
+        {   return false;   }
+    }
+
+    // Apply the options of the active decoder
+    if ( (decoder_id != 0U) && (decoder_id == uart_cfg[uart_n].decoder) )
+    {   return decoder[uart_n]->configure(argc - 1, &(argv[1]));   }
+
+    // Check the new decoder options and framing before removing the active
+    // decoder (the Port decoder storage is in use by it)
+    UARTDecoder::t_framing framing = UARTDecoder::t_framing::LINE;
+    uint32_t param = 0U;
+    if (decoder_id != 0U)
+    {
+        alignas(UARTDecoders::STORAGE_ALIGN)
+            uint8_t check_storage[UARTDecoders::STORAGE_SIZE];
+        UARTDecoder* check_decoder = UARTDecoders::create(decoder_id,
+            check_storage);
+        if (check_decoder == nullptr)
+        {   return false;   }
+        bool valid = check_decoder->configure(argc - 1, &(argv[1]));
+        check_decoder->get_framing(&framing, &param);
+        check_decoder->~UARTDecoder();
+        if (valid == false)
+        {   return false;   }
+        if ( (framing == UARTDecoder::t_framing::IDLE) ?
+             (param > MAX_FRAME_IDLE_CHARS) : (param > UINT8_MAX) )
+        {   return false;   }
+    }
+
+    // Remove the active decoder (its pending records are published)
+    batch_flush(uart_n);
+    if (decoder[uart_n] != nullptr)
+    {
+        decoder[uart_n]->set_char_time(uart_char_time_us(uart_n));
+        decoder[uart_n]->flush(INT64_MAX);
+        decoder[uart_n]->~UARTDecoder();
+        decoder[uart_n] = nullptr;
+    }
+    uart_cfg[uart_n].decoder = 0U;
+    if (decoder_id == 0U)
+    {   return true;   }
+
+    // Build the new decoder and publish its records to its own topic
+    UARTDecoder* port_decoder = UARTDecoders::create(decoder_id,
+        decoder_storage[uart_n]);
+    if (port_decoder == nullptr)
+    {   return false;   }
+    char* topic_name = strrchr(topic_decoder[uart_n], '/') + 1;
+    snprintf(topic_name, sizeof(topic_decoder[uart_n]) -
+        (size_t)(topic_name - topic_decoder[uart_n]), "%s", argv[0]);
+    port_decoder->set_sink(decoder_sink, topic_decoder[uart_n]);
+
+    // Apply the decoder options (already checked)
+    if (port_decoder->configure(argc - 1, &(argv[1])) == false)
+    {
+        port_decoder->~UARTDecoder();
+        return false;
+    }
+
+    // Set the framing and timestamps required by the decoder
+    t_uart_framing port_framing = (framing == UARTDecoder::t_framing::IDLE) ?
+        t_uart_framing::IDLE : t_uart_framing::LINE;
+    if (uart_config_framing(uart_n, port_framing, param) == false)
+    {
+        port_decoder->~UARTDecoder();
+        return false;
+    }
+    if ( port_decoder->needs_timestamps() &&
+         (uart_cfg[uart_n].timestamps == t_uart_timestamps::OFF) )
+    {   uart_cfg[uart_n].timestamps = t_uart_timestamps::ON;   }
+
+    decoder[uart_n] = port_decoder;
+    uart_cfg[uart_n].decoder = decoder_id;
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to configure the repeated Rx frames
+ * collapsing of an UART Port by modifying the value of the Global uart_cfg
+ * dedup_ms field. Any pending summary is published first, and the next frame
+ * is always published.
+ */
+bool InterfaceUART::uart_config_dedup(const uint8_t uart_n,
+        const uint32_t window_ms)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if the window is out of range
+    if (window_ms > MAX_DEDUP_MS)
+    {   return false;   }
+
+    dedup_flush(uart_n);
+    dedup_len[uart_n] = 0U;
+    t_dedup_last[uart_n] = millis() - window_ms;
+    ns_device::ns_uart::uart_cfg[uart_n].dedup_ms = window_ms;
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to configure the Rx overload policy of
+ * an UART Port by modifying the value of the Global uart_cfg overload field.
+ * Any overload in progress is left first (reporting it), so the capture is
+ * resumed and the new policy starts from a new measure.
+ */
+bool InterfaceUART::uart_config_overload(const uint8_t uart_n,
+        const ns_device::ns_uart::t_uart_overload policy)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    overload_reset(uart_n);
+    ns_device::ns_uart::uart_cfg[uart_n].overload = policy;
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to configure the Rx frames timestamping
+ * of an UART Port by modifying the value of the Global uart_cfg timestamps
+ * field. Any pending batch is published before applying the new mode, so a
+ * batch never mixes raw frames and timestamped records.
+ */
+bool InterfaceUART::uart_config_timestamps(const uint8_t uart_n,
+        const ns_device::ns_uart::t_uart_timestamps mode)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if disabling timestamps of a paired Port (required to
+    // merge its frames), a Port with in-band line events or a Port with a
+    // decoder that needs them
+    if ( (mode == ns_device::ns_uart::t_uart_timestamps::OFF) &&
+         ( (ns_device::ns_uart::uart_cfg[uart_n].pair_port != 0U) ||
+           (ns_device::ns_uart::uart_cfg[uart_n].line_events) ||
+           ( (decoder[uart_n] != nullptr) &&
+             decoder[uart_n]->needs_timestamps() ) ) )
+    {   return false;   }
+
+    batch_flush(uart_n);
+    ns_device::ns_uart::uart_cfg[uart_n].timestamps = mode;
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to bind two UART Ports as a pair by
+ * modifying the values of the Global uart_cfg pair fields of both of them.
+ * Any previous pair of the Ports is unbound first (publishing its queued
+ * frames). The frames of paired Ports are merged by timestamp, so the
+ * timestamps are enabled on both Ports if they were off.
+ */
+bool InterfaceUART::uart_config_pair(const uint8_t uart_n,
+        const uint8_t pair_n, const uint32_t window_ms)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port numbers are invalid
+    if ( (uart_n >= ns_const::MAX_NUM_UART) ||
+         (pair_n >= ns_const::MAX_NUM_UART) || (pair_n == uart_n) )
+    {   return false;   }
+
+    // Do nothing if the reorder window is out of range
+    if (window_ms > MAX_PAIR_WINDOW_MS)
+    {   return false;   }
+
+    // Unbind previous pairs of both Ports
+    uint8_t ports[2] = { uart_n, pair_n };
+    for (uint8_t i = 0U; i < 2U; i++)
+    {
+        uint8_t port_n = ports[i];
+        uint8_t prev_n = uart_cfg[port_n].pair_port;
+        if ( (port_n == 0U) || (prev_n == 0U) )
+        {   continue;   }
+
+        pair_merge((port_n < prev_n) ? port_n : prev_n, true);
+        batch_flush(port_n);
+        batch_flush(prev_n);
+        uart_cfg[port_n].pair_port = 0U;
+        uart_cfg[prev_n].pair_port = 0U;
+        pair_head[port_n] = 0U;
+        pair_tail[port_n] = 0U;
+        pair_head[prev_n] = 0U;
+        pair_tail[prev_n] = 0U;
+    }
+
+    // Unpair request
+    if (pair_n == 0U)
+    {   return true;   }
+
+    // Bind the Ports
+    for (uint8_t i = 0U; i < 2U; i++)
+    {
+        s_uart_config* cfg = &(uart_cfg[ports[i]]);
+        batch_flush(ports[i]);
+        if (cfg->timestamps == t_uart_timestamps::OFF)
+        {   cfg->timestamps = t_uart_timestamps::ON;   }
+        cfg->pair_port = ports[(i + 1U) % 2U];
+        cfg->pair_window_ms = (uint16_t)(window_ms);
+    }
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to bridge two UART Ports by modifying
+ * the values of the Global uart_cfg bridge fields of both of them. Any
+ * previous bridge of the Ports is removed first. The bridged Ports are
+ * switched to the Event-Driven engine (whose capture tasks do the
+ * forwarding) and restarted to apply the bridge low latency Rx thresholds.
+ */
+bool InterfaceUART::uart_config_bridge(const uint8_t uart_n,
+        const uint8_t bridge_n)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port numbers are invalid
+    if ( (uart_n >= ns_const::MAX_NUM_UART) ||
+         (bridge_n >= ns_const::MAX_NUM_UART) || (bridge_n == uart_n) )
+    {   return false;   }
+
+    // Remove previous bridges of both Ports
+    uint8_t ports[2] = { uart_n, bridge_n };
+    for (uint8_t i = 0U; i < 2U; i++)
+    {
+        uint8_t port_n = ports[i];
+        uint8_t prev_n = uart_cfg[port_n].bridge_port;
+        if ( (port_n == 0U) || (prev_n == 0U) )
+        {   continue;   }
+
+        Capture.set_bridge(port_n, port_n);
+        Capture.set_bridge(prev_n, prev_n);
+        uart_cfg[port_n].bridge_port = 0U;
+        uart_cfg[prev_n].bridge_port = 0U;
+        capture_restart(port_n);
+        capture_restart(prev_n);
+    }
+
+    // Remove bridge request
+    if (bridge_n == 0U)
+    {   return true;   }
+
+    // Bridge the Ports
+    for (uint8_t i = 0U; i < 2U; i++)
+    {
+        if (uart_config_engine(ports[i], t_uart_engine::EVENT) == false)
+        {   return false;   }
+    }
+    uart_cfg[uart_n].bridge_port = bridge_n;
+    uart_cfg[bridge_n].bridge_port = uart_n;
+    Capture.set_bridge(uart_n, bridge_n);
+    Capture.set_bridge(bridge_n, uart_n);
+    bool success = true;
+    for (uint8_t i = 0U; i < 2U; i++)
+    {
+        if (capture_restart(ports[i]) == false)
+        {   success = false;   }
+    }
+
+    return success;
+}
+
+/**
+ * @details This function is a setter to configure the raw TCP serial server
+ * of an UART Port by modifying the value of the Global uart_cfg tcp_port
+ * field. A running server is stopped, so it is started again on the new TCP
+ * port by process().
+ */
+bool InterfaceUART::uart_config_tcp(const uint8_t uart_n,
+        const uint16_t tcp_port)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if the TCP port is used by other UART Port
+    for (uint8_t i = 1U; i < ns_const::MAX_NUM_UART; i++)
+    {
+        if ( (i != uart_n) && (tcp_port != 0U) &&
+             (uart_cfg[i].tcp_port == tcp_port) )
+        {   return false;   }
+    }
+
+    uart_cfg[uart_n].tcp_port = tcp_port;
+    tcp_server[uart_n].stop();
+    t_tcp_start[uart_n] = millis() - T_TCP_RETRY_MS;
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to select the capture engine of an UART
+ * Port by modifying the value of the Global uart_cfg engine field. If the
+ * Port is enabled, the capture of the current engine is stopped and the new
+ * one is started.
+ */
+bool InterfaceUART::uart_config_engine(const uint8_t uart_n,
+        const ns_device::ns_uart::t_uart_engine engine)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if the engine is already in use
+    if (ns_device::ns_uart::uart_cfg[uart_n].engine == engine)
+    {   return true;   }
+
+    // Do nothing if the Port is bridged (requires the Event-Driven engine)
+    if (ns_device::ns_uart::uart_cfg[uart_n].bridge_port != 0U)
+    {   return false;   }
+
+    if (ns_device::ns_uart::uart_cfg[uart_n].enable == false)
+    {
+        ns_device::ns_uart::uart_cfg[uart_n].engine = engine;
+        return true;
+    }
+
+    capture_stop(uart_n);
+    ns_device::ns_uart::uart_cfg[uart_n].engine = engine;
+    if (capture_start(uart_n) == false)
+    {
+        ns_device::ns_uart::uart_cfg[uart_n].enable = false;
+        port_memory_free(uart_n);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @details This function is a setter to enable or disable an UART Port by
+ * modifying the value of the Global uart_cfg enable field and starting or
+ * stopping the Port capture engine.
+ */
+bool InterfaceUART::uart_enable(const uint8_t uart_n, const bool enable)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Start/Stop the Port capture
+    if (enable)
+    {
+        if (capture_start(uart_n) == false)
+        {
+            port_memory_free(uart_n);
+            return false;
+        }
+    }
+    else
+    {
+        capture_stop(uart_n);
+        autobaud[uart_n].stop();
+        dedup_flush(uart_n);
+        uint8_t pair_n = ns_device::ns_uart::uart_cfg[uart_n].pair_port;
+        if (pair_n != 0U)
+        {   pair_merge((uart_n < pair_n) ? uart_n : pair_n, true);   }
+        batch_flush(uart_n);
+        tx_echo_flush(uart_n);
+        port_memory_free(uart_n);
+    }
+
+    ns_device::ns_uart::uart_cfg[uart_n].enable = enable;
+
+    return true;
+}
+
+/**
+ * @details This function queues the provided string message to be
+ * transmitted through the UART Port (see the binary message method).
+ */
+bool InterfaceUART::uart_tx_msg(const uint8_t uart_n, const char* msg)
+{
+    // Do nothing if there is no message
+    if (msg == nullptr)
+    {   return false;   }
+
+    return uart_tx_msg(uart_n, (const uint8_t*)(msg), strlen(msg));
+}
+
+/**
+ * @details This function checks that the provided UART Port number is valid
+ * and has been enabled, then it adds the message to the Port Tx queue to be
+ * transmitted by the capture engine (so the caller, usually the MQTT
+ * reception callback, is never blocked by the UART speed or flow control).
+ * If the message doesn't fit in the queue it is rejected as a whole and a
+ * NACK is published through the MQTT Configuration topic. Queued messages
+ * are echoed through the MQTT Tx echo topic to acknowledge them.
+ */
+bool InterfaceUART::uart_tx_msg(const uint8_t uart_n, const uint8_t* data,
+        const size_t len)
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if the UART Port was not enabled
+    if (ns_device::ns_uart::uart_cfg[uart_n].enable == false)
+    {   return false;   }
+
+    // Do nothing if the UART Port Tx is used by a bridge
+    if (ns_device::ns_uart::uart_cfg[uart_n].bridge_port != 0U)
+    {   return false;   }
+
+    // Reject the message if the Tx queue has no room for it
+    if (len > (size_t)(tx_ring[uart_n].free_space()))
+    {
+        tx_num_rejected[uart_n] = tx_num_rejected[uart_n] + 1U;
+        mqtt_send_tx_nack(uart_n, len);
+        return false;
+    }
+
+    // Queue the message to be transmitted through the UART Port
+    uart_tx_queue(uart_n, data, (uint32_t)(len));
+
+    // Publish to MQTT to notify transmission
+    tx_echo(uart_n, data, (uint32_t)(len));
+
+    return true;
+}
+
+/**
+ * @details This function checks that the provided UART Port number is valid
+ * and has been enabled, then it queues each of the messages from the provided
+ * argument list to be sent through the UART port. The messages are rejected
+ * as a whole if they don't fit in the Port Tx queue.
+ */
+bool InterfaceUART::uart_tx_msg(const uint8_t uart_n, int argc, char* argv[])
+{
+    // Do nothing if component was not initialized
+    if (initialized == false)
+    {   return false;   }
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if the UART Port was not enabled
+    if (ns_device::ns_uart::uart_cfg[uart_n].enable == false)
+    {   return false;   }
+
+    // Do nothing if the UART Port Tx is used by a bridge
+    if (ns_device::ns_uart::uart_cfg[uart_n].bridge_port != 0U)
+    {   return false;   }
+
+    // Reject the messages if the Tx queue has no room for them
+    size_t len = 0U;
+    for (int i = 0; i < argc; i++)
+    {   len = len + strlen(argv[i]);   }
+    if (len > (size_t)(tx_ring[uart_n].free_space()))
+    {
+        tx_num_rejected[uart_n] = tx_num_rejected[uart_n] + 1U;
+        mqtt_send_tx_nack(uart_n, len);
+        return false;
+    }
+
+    // Queue the messages to be transmitted through the UART Port
+    for (int i = 0; i < argc; i++)
+    {
+        uart_tx_queue(uart_n, (const uint8_t*)(argv[i]),
+            (uint32_t)(strlen(argv[i])));
+    }
+
+    // Publish to MQTT to notify transmission
+    char msg_tx[DATA_RX_BUFFER_SIZE];
+    msg_tx[0] = '\0';
+    if (single_str_from_array_of_str(argc, argv, msg_tx, DATA_RX_BUFFER_SIZE))
+    {   tx_echo(uart_n, (const uint8_t*)(msg_tx), strlen(msg_tx));   }
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details Checks if the UART is enabled and configured, then drains all the
+ * bytes that are available in the Port Rx ring buffer in bulk (instead of one
+ * byte per call), feeding them to the Port framer directly from the ring
+ * buffer memory and forwarding each completed frame through MQTT. Any
+ * partial frame is kept in the framer to be completed in next calls, or
+ * flushed if the IDLE framing inter-byte silence has elapsed. The number of
+ * bytes handled in the call is tracked to be reported in the UART Status
+ * information, and the time spent handling them (publish included) to measure
+ * the Port publish throughput for its overload policy.
+ * If timestamping is enabled, the arrival time of the first byte of each
+ * frame is taken before feeding it to the framer (and with per-byte deltas,
+ * the bytes are fed one by one to take the arrival time of each one).
+ * Poll engine Ports are captured again after each MQTT publish, so a slow
+ * publish doesn't let the Serial Port buffers overflow.
+ */
+bool InterfaceUART::handle_uart_rx(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    bool msg_published = false;
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return false;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if the UART Port was not enabled
+    if (uart_cfg[uart_n].enable == false)
+    {   return false;   }
+
+    UARTFramer* port_framer = &(framer[uart_n]);
+    uint32_t num_available = rx_ring[uart_n].available();
+
+    // Publish the line events that happened before the data to handle
+    rx_line_events(uart_n, rx_ring[uart_n].get_read_count());
+
+    // Check for IDLE framing inter-byte silence if there is no new data
+    if (num_available == 0U)
+    {
+        if ( (uart_cfg[uart_n].framing != t_uart_framing::IDLE) ||
+             (port_framer->get_length() == 0U) )
+        {   return false;   }
+
+        uint32_t t_idle_us = uart_char_time_us(uart_n) *
+            (uint32_t)(uart_cfg[uart_n].frame_idle_chars);
+        if ((uint32_t)(micros()) - t_last_rx_us[uart_n] < t_idle_us)
+        {   return false;   }
+
+        if (port_framer->flush())
+        {
+            msg_published = publish_frame(uart_n, port_framer->get_frame(),
+                port_framer->get_frame_length());
+            port_framer->frame_done();
+        }
+        return msg_published;
+    }
+
+    // Drain all the bytes that were available at the start of the call
+    uint32_t t_start_us = (uint32_t)(micros());
+    t_uart_timestamps ts_mode = uart_cfg[uart_n].timestamps;
+    uint32_t char_time_us = uart_char_time_us(uart_n);
+    uint32_t num_handled = 0U;
+    while (num_handled < num_available)
+    {
+        const uint8_t* ptr = nullptr;
+        uint32_t region = rx_ring[uart_n].read_region(&ptr);
+        if (region == 0U)
+        {   break;   }
+        if (region > num_available - num_handled)
+        {   region = num_available - num_handled;   }
+        uint32_t offset = rx_ring[uart_n].get_read_count();
+
+        // Stream the raw data block to the TCP client from the ring buffer
+        tcp_server[uart_n].send(ptr, region);
+
+        // Split the data block into frames and publish each one
+        uint32_t num_used = 0U;
+        while (num_used < region)
+        {
+            uint32_t num_feed = region - num_used;
+
+            // Don't feed the framer beyond the next line event
+            uint32_t event_offset = 0U;
+            rx_line_events(uart_n, offset + num_used);
+            if (rx_events[uart_n].next_offset(&event_offset))
+            {
+                uint32_t to_event = event_offset - (offset + num_used);
+                if (to_event < num_feed)
+                {   num_feed = to_event;   }
+            }
+
+            if (ts_mode == t_uart_timestamps::DELTAS)
+            {
+                rx_stamp(uart_n, offset + num_used, char_time_us);
+                num_feed = 1U;
+            }
+            else if ( (ts_mode == t_uart_timestamps::ON) &&
+                      (port_framer->get_length() == 0U) )
+            {   rx_stamp(uart_n, offset + num_used, char_time_us);   }
+
+            num_feed = port_framer->feed(&(ptr[num_used]), num_feed);
+            recorder[uart_n].write(&(ptr[num_used]), num_feed);
+            num_used = num_used + num_feed;
+            if (port_framer->frame_ready() == false)
+            {   continue;   }
+
+            if (publish_frame(uart_n, port_framer->get_frame(),
+                    port_framer->get_frame_length()))
+            {   msg_published = true;   }
+            port_framer->frame_done();
+            capture_poll();
+        }
+
+        rx_ring[uart_n].consume(region);
+        num_handled = num_handled + region;
+    }
+    rx_marks[uart_n].release(rx_ring[uart_n].get_read_count());
+    rx_line_events(uart_n, rx_ring[uart_n].get_read_count());
+    t_last_rx_us[uart_n] = (uint32_t)(micros());
+
+    // Measure the publish throughput for the overload policy
+    if (uart_cfg[uart_n].overload != t_uart_overload::OFF)
+    {
+        overload[uart_n].add_handled(num_handled,
+            t_last_rx_us[uart_n] - t_start_us);
+    }
+
+    // Keep track of the maximum number of bytes handled in a single call
+    if (num_handled > rx_burst_max[uart_n])
+    {   rx_burst_max[uart_n] = num_handled;   }
+
+    return msg_published;
+}
+
+/**
+ * @details This function publishes the frame directly if batching is not
+ * enabled for the Port. Otherwise the frame is appended to the Port batch so
+ * frame boundaries can be recovered from it:
+ * - LINE framing: The frame is followed by the line delimiter (but template
+ *   encoded lines, that are binary, are delimited as binary frames).
+ * - Binary framings: The frame is preceded by its length (2 bytes, big
+ *   endian).
+ * - Timestamped frames: The frame record is self-delimited.
+ * While the Port is overloaded with the summary policy, the frames are only
+ * counted (they are reported in the overload reports of the status topic).
+ * The frames of Ports with a protocol decoder are fed to it, which publishes
+ * its records through its sink (the frames are then only published if the
+ * decoder passes the raw frames too). Frames that don't pass the Port filter
+ * are dropped first (line event records are never filtered). While the
+ * flight recorder is enabled, the frames are only checked against its
+ * trigger patterns (the received data is recorded as is by the reception
+ * handling).
+ * The repetitions of the previous frame are suppressed if collapsing is
+ * enabled (a line event ends the run), and log lines are replaced by their
+ * template encoding if enabled.
+ * The frames of paired Ports are queued to be merged instead.
+ * The batch is published first if the frame doesn't fit in it, and then
+ * published if it reaches the configured size.
+ * Timestamped records that are published alone are built in the (empty)
+ * batch buffer of the Port.
+ */
+bool InterfaceUART::publish_frame(const uint8_t uart_n, const uint8_t* frame,
+        const uint32_t len)
+{
+    using namespace ns_device::ns_uart;
+
+    s_uart_config* cfg = &(uart_cfg[uart_n]);
+
+    // Drop the frames received at a wrong speed while detecting it
+    if (autobaud[uart_n].get_state() == UARTAutobaud::t_state::DETECTING)
+    {   return false;   }
+
+    // Only summarize the frames while overloaded
+    if ( (cfg->overload == t_uart_overload::SUMMARY) &&
+         (rx_record_flags[uart_n] == 0U) &&
+         overload[uart_n].is_overloaded() )
+    {
+        overload[uart_n].add_summarized(len);
+        return false;
+    }
+
+    // Protocol decoder frames are published as decoded records
+    UARTDecoder* port_decoder = decoder[uart_n];
+    if ( (port_decoder != nullptr) && (rx_record_flags[uart_n] == 0U) )
+    {
+        int64_t t_us = (cfg->timestamps != t_uart_timestamps::OFF) ?
+            t_frame_us[uart_n] : esp_timer_get_time();
+        uint32_t num_records = port_decoder->get_num_records();
+        port_decoder->set_char_time(uart_char_time_us(uart_n));
+        port_decoder->feed(frame, len, t_us);
+        if (port_decoder->pass_raw() == false)
+        {   return (port_decoder->get_num_records() != num_records);   }
+    }
+
+    // Drop the frames filtered out
+    if ( (rx_record_flags[uart_n] == 0U) &&
+         (rx_filter[uart_n].pass(frame, len) == false) )
+    {   return false;   }
+
+    // Frames are recorded instead of published by the flight recorder
+    if (recorder[uart_n].get_state() != UARTRecorder::t_state::OFF)
+    {
+        if ( (rx_record_flags[uart_n] == 0U) &&
+             (rec_match[uart_n].get_num_patterns() > 0U) &&
+             rec_match[uart_n].pass(frame, len) )
+        {   recorder[uart_n].trigger();   }
+        return false;
+    }
+
+    // Collapse the repetitions of the previous frame
+    if (rx_record_flags[uart_n] == 0U)
+    {
+        if (dedup_check(uart_n, frame, len))
+        {   return true;   }
+    }
+    else if ((rx_record_flags[uart_n] & RX_RECORD_FLAG_EVENT) != 0U)
+    {
+        dedup_flush(uart_n);
+        dedup_len[uart_n] = 0U;
+    }
+
+    // Log lines are encoded with their template (raw repeated frames
+    // summaries too, as they share the stream with the encoded lines)
+    bool is_stamped = (cfg->timestamps != t_uart_timestamps::OFF);
+    if ( (cfg->framing == t_uart_framing::LINE) &&
+         rx_templates[uart_n].is_enabled() && (tpl_data[uart_n] != nullptr) &&
+         ( (rx_record_flags[uart_n] == 0U) ||
+           ( (rx_record_flags[uart_n] == RX_RECORD_FLAG_REPEAT) &&
+             (is_stamped == false) ) ) )
+    {   return publish_template(uart_n, frame, len);   }
+
+    // Frames of paired Ports are published merged with the other Port ones
+    if ( (cfg->pair_port != 0U) && (pair_data[uart_n] != nullptr) )
+    {   return pair_push(uart_n, frame, len);   }
+
+    // Frames are published as is if there is no memory to batch them or to
+    // build their records
+    if (batch_data[uart_n] == nullptr)
+    {   return mqtt_publish_rx(uart_n, frame, len);   }
+
+    uint32_t batch_size = (uint32_t)(cfg->batch_size);
+    bool is_line = (cfg->framing == t_uart_framing::LINE) &&
+        ((rx_record_flags[uart_n] & RX_RECORD_FLAG_TEMPLATE) == 0U);
+    uint32_t overhead = (is_line) ? 1U : BATCH_FRAME_LEN_SIZE;
+    if (is_stamped)
+    {   overhead = rx_record_size(uart_n, len) - len;   }
+
+    // Batching disabled or frame larger than a batch
+    if ( (batch_size == 0U) || (len + overhead > batch_size) )
+    {
+        batch_flush(uart_n);
+        if (is_stamped)
+        {
+            uint32_t record_len = rx_record_write(uart_n, frame, len,
+                batch_data[uart_n]);
+            return mqtt_publish_rx(uart_n, batch_data[uart_n], record_len);
+        }
+        return mqtt_publish_rx(uart_n, frame, len);
+    }
+
+    // Publish pending batch if the frame doesn't fit
+    if (batch_len[uart_n] + len + overhead > batch_size)
+    {   batch_flush(uart_n);   }
+
+    // Append the frame and its boundary
+    uint8_t* ptr_batch = &(batch_data[uart_n][batch_len[uart_n]]);
+    if (batch_len[uart_n] == 0U)
+    {   t_batch_start[uart_n] = millis();   }
+    if (is_stamped)
+    {   rx_record_write(uart_n, frame, len, ptr_batch);   }
+    else if (is_line)
+    {
+        memcpy(ptr_batch, frame, len);
+        ptr_batch[len] = cfg->frame_delimiter;
+    }
+    else
+    {
+        ptr_batch[0] = (uint8_t)((len >> 8) & 0xFFU);
+        ptr_batch[1] = (uint8_t)(len & 0xFFU);
+        memcpy(&(ptr_batch[BATCH_FRAME_LEN_SIZE]), frame, len);
+    }
+    batch_len[uart_n] = batch_len[uart_n] + len + overhead;
+
+    // Publish the batch if it is full
+    if (batch_len[uart_n] >= batch_size)
+    {   return batch_flush(uart_n);   }
+
+    return true;
+}
+
+/**
+ * @details This function takes the queued line events of the Port that
+ * happened at or before the data position. If in-band line events are
+ * enabled, the partial frame in progress is completed and published (the
+ * error splits it), and the event is published as a timestamped record with
+ * the event flag, the event time and the event type as its only data byte
+ * (through the frames path, so it is batched and merged with pairs as any
+ * other record). Otherwise the events are only counted.
+ */
+void InterfaceUART::rx_line_events(const uint8_t uart_n,
+        const uint32_t offset)
+{
+    using namespace ns_device::ns_uart;
+
+    UARTLineEvents::s_event event;
+    while (rx_events[uart_n].peek(offset, &event))
+    {
+        rx_events[uart_n].pop();
+        if ( (uart_cfg[uart_n].line_events == false) ||
+             (uart_cfg[uart_n].timestamps == t_uart_timestamps::OFF) )
+        {   continue;   }
+
+        if (framer[uart_n].flush())
+        {
+            publish_frame(uart_n, framer[uart_n].get_frame(),
+                framer[uart_n].get_frame_length());
+            framer[uart_n].frame_done();
+        }
+
+        uint8_t event_type = (uint8_t)(event.type);
+        t_frame_us[uart_n] = event.t_us;
+        num_frame_deltas[uart_n] = 0U;
+        rx_record_flags[uart_n] = RX_RECORD_FLAG_EVENT;
+        publish_frame(uart_n, &event_type, 1U);
+        rx_record_flags[uart_n] = 0U;
+    }
+}
+
+/**
+ * @details This function maps the Arduino Serial error of a Poll engine Port
+ * to a line event, positioned after the data already received by the Serial
+ * Port (captured or still in its buffer).
+ */
+void InterfaceUART::poll_line_event(const uint8_t uart_n,
+        const hardwareSerial_error_t error)
+{
+    UARTLineEvents::t_event type;
+    switch (error)
+    {
+        case UART_PARITY_ERROR:
+            type = UARTLineEvents::t_event::PARITY_ERR;
+            break;
+        case UART_FRAME_ERROR:
+            type = UARTLineEvents::t_event::FRAME_ERR;
+            break;
+        case UART_BREAK_ERROR:
+            type = UARTLineEvents::t_event::BREAK;
+            break;
+        case UART_FIFO_OVF_ERROR:
+            type = UARTLineEvents::t_event::FIFO_OVF;
+            break;
+        case UART_BUFFER_FULL_ERROR:
+            type = UARTLineEvents::t_event::BUFFER_FULL;
+            break;
+        default:
+            return;
+    }
+
+    uint32_t offset = rx_ring[uart_n].get_write_count();
+    int num_buffered = SerialPort[uart_n]->available();
+    if (num_buffered > 0)
+    {   offset = offset + (uint32_t)(num_buffered);   }
+    rx_events[uart_n].push(type, offset, esp_timer_get_time());
+}
+
+/**
+ * @details This function gets the arrival time of the byte from the Port
+ * timestamps marks. If no byte of the frame has been received yet (empty
+ * framer), the time is taken as the frame timestamp, otherwise the time
+ * elapsed since the previous byte is added to the frame deltas (saturated to
+ * 16 bits).
+ */
+void InterfaceUART::rx_stamp(const uint8_t uart_n, const uint32_t offset,
+        const uint32_t char_time_us)
+{
+    int64_t t_us = rx_marks[uart_n].byte_time(offset, char_time_us);
+
+    if (framer[uart_n].get_length() == 0U)
+    {
+        t_frame_us[uart_n] = t_us;
+        num_frame_deltas[uart_n] = 0U;
+    }
+    else if ( (frame_deltas[uart_n] != nullptr) &&
+              (num_frame_deltas[uart_n] < DATA_RX_BUFFER_SIZE) )
+    {
+        int64_t delta = t_us - t_prev_byte_us[uart_n];
+        if (delta < 0)
+        {   delta = 0;   }
+        if (delta > UINT16_MAX)
+        {   delta = UINT16_MAX;   }
+        uint8_t* ptr_delta =
+            &(frame_deltas[uart_n][2U * num_frame_deltas[uart_n]]);
+        ptr_delta[0] = (uint8_t)(delta & 0xFF);
+        ptr_delta[1] = (uint8_t)((delta >> 8) & 0xFF);
+        num_frame_deltas[uart_n] = num_frame_deltas[uart_n] + 1U;
+    }
+    t_prev_byte_us[uart_n] = t_us;
+}
+
+/**
+ * @details This function calculates the size of the timestamped record of a
+ * frame: header, frame data and, in deltas mode, the deltas count and list.
+ */
+uint32_t InterfaceUART::rx_record_size(const uint8_t uart_n,
+        const uint32_t len)
+{
+    using namespace ns_device::ns_uart;
+
+    uint32_t size = RX_RECORD_HEADER_SIZE + len;
+    if (uart_cfg[uart_n].timestamps == t_uart_timestamps::DELTAS)
+    {   size = size + 2U + (2U * num_frame_deltas[uart_n]);   }
+
+    return size;
+}
+
+/**
+ * @details This function writes the timestamped record of a frame (all
+ * fields little endian):
+ * - Flags (1 byte): Bit 0 set if the deltas list is present. Bit 1 set if
+ *   the frame was received by the secondary Port of a pair. Bit 2 set if the
+ *   record is a line event (the data is the event type).
+ * - Timestamp (8 bytes): Arrival time of the first byte (esp_timer us).
+ * - Length (2 bytes): Frame length.
+ * - Frame data.
+ * - Deltas mode only: Deltas count (2 bytes) and the inter-arrival time of
+ *   each byte of the frame after the first one (2 bytes each, us). The count
+ *   includes the framing bytes (delimiters, escapes) received with the frame.
+ */
+uint32_t InterfaceUART::rx_record_write(const uint8_t uart_n,
+        const uint8_t* frame, const uint32_t len, uint8_t* record)
+{
+    using namespace ns_device::ns_uart;
+
+    bool with_deltas =
+        (uart_cfg[uart_n].timestamps == t_uart_timestamps::DELTAS);
+    uint8_t pair_n = uart_cfg[uart_n].pair_port;
+    uint64_t t_us = (uint64_t)(t_frame_us[uart_n]);
+
+    record[0] = (with_deltas) ? RX_RECORD_FLAG_DELTAS : 0U;
+    record[0] = record[0] | rx_record_flags[uart_n];
+    if ( (pair_n != 0U) && (pair_n < uart_n) )
+    {   record[0] = record[0] | RX_RECORD_FLAG_DIR;   }
+    for (uint8_t i = 0U; i < 8U; i++)
+    {   record[1U + i] = (uint8_t)((t_us >> (8U * i)) & 0xFFU);   }
+    record[9] = (uint8_t)(len & 0xFFU);
+    record[10] = (uint8_t)((len >> 8) & 0xFFU);
+    memcpy(&(record[RX_RECORD_HEADER_SIZE]), frame, len);
+
+    uint32_t size = RX_RECORD_HEADER_SIZE + len;
+    if (with_deltas == false)
+    {   return size;   }
+
+    uint32_t num_deltas = num_frame_deltas[uart_n];
+    record[size] = (uint8_t)(num_deltas & 0xFFU);
+    record[size + 1U] = (uint8_t)((num_deltas >> 8) & 0xFFU);
+    size = size + 2U;
+    if (num_deltas > 0U)
+    {
+        memcpy(&(record[size]), frame_deltas[uart_n], 2U * num_deltas);
+        size = size + (2U * num_deltas);
+    }
+
+    return size;
+}
+
+/**
+ * @details This function publishes the record directly if batching is not
+ * enabled for the Port (or the record is larger than a batch). Otherwise the
+ * record is appended to the Port batch as is (records are self-delimited),
+ * publishing the batch first if the record doesn't fit in it, and then if it
+ * reaches the configured size.
+ */
+bool InterfaceUART::publish_record(const uint8_t uart_n,
+        const uint8_t* record, const uint32_t size)
+{
+    uint32_t batch_size =
+        (uint32_t)(ns_device::ns_uart::uart_cfg[uart_n].batch_size);
+
+    // Batching disabled, record larger than a batch or no batch memory
+    if ( (batch_size == 0U) || (size > batch_size) ||
+         (batch_data[uart_n] == nullptr) )
+    {
+        batch_flush(uart_n);
+        return mqtt_publish_rx(uart_n, record, size);
+    }
+
+    // Publish pending batch if the record doesn't fit
+    if (batch_len[uart_n] + size > batch_size)
+    {   batch_flush(uart_n);   }
+
+    // Append the record
+    if (batch_len[uart_n] == 0U)
+    {   t_batch_start[uart_n] = millis();   }
+    memcpy(&(batch_data[uart_n][batch_len[uart_n]]), record, size);
+    batch_len[uart_n] = batch_len[uart_n] + size;
+
+    // Publish the batch if it is full
+    if (batch_len[uart_n] >= batch_size)
+    {   return batch_flush(uart_n);   }
+
+    return true;
+}
+
+/**
+ * @details This function writes the timestamped record of the frame at the
+ * end of the Port pair queue. If there is no room for it, the oldest records
+ * of the pair are published until there is (the queue is compacted to its
+ * start when the record doesn't fit at its end). Then the pair queues are
+ * merged.
+ */
+bool InterfaceUART::pair_push(const uint8_t uart_n, const uint8_t* frame,
+        const uint32_t len)
+{
+    uint8_t pair_n = ns_device::ns_uart::uart_cfg[uart_n].pair_port;
+    uint8_t primary_n = (uart_n < pair_n) ? uart_n : pair_n;
+    uint32_t size = rx_record_size(uart_n, len);
+
+    // Do nothing if the record doesn't fit in the queue
+    if (size > PAIR_QUEUE_SIZE)
+    {   return false;   }
+
+    // Make room for the record
+    while (PAIR_QUEUE_SIZE - (pair_tail[uart_n] - pair_head[uart_n]) < size)
+    {
+        int64_t t_us = 0;
+        int64_t t_pair_us = 0;
+        bool queued = pair_head_time(uart_n, &t_us);
+        bool pair_queued = pair_head_time(pair_n, &t_pair_us);
+        if ( pair_queued && ( (queued == false) || (t_pair_us < t_us) ) )
+        {   pair_pop(pair_n);   }
+        else
+        {   pair_pop(uart_n);   }
+    }
+    if (PAIR_QUEUE_SIZE - pair_tail[uart_n] < size)
+    {
+        uint32_t num_queued = pair_tail[uart_n] - pair_head[uart_n];
+        memmove(pair_data[uart_n], &(pair_data[uart_n][pair_head[uart_n]]),
+            num_queued);
+        pair_head[uart_n] = 0U;
+        pair_tail[uart_n] = num_queued;
+    }
+
+    rx_record_write(uart_n, frame, len,
+        &(pair_data[uart_n][pair_tail[uart_n]]));
+    pair_tail[uart_n] = pair_tail[uart_n] + size;
+
+    pair_merge(primary_n, false);
+
+    return true;
+}
+
+/**
+ * @details This function is a two-way merge of the pair queues: while both
+ * Ports have queued records, the oldest one is published (the records of
+ * each Port are already in order). When only one Port has queued records,
+ * its oldest one is published once the reorder window has elapsed since its
+ * first byte was received (a frame of the other Port that started before it
+ * could still be in reception).
+ */
+void InterfaceUART::pair_merge(const uint8_t uart_n, const bool flush)
+{
+    uint8_t pair_n = ns_device::ns_uart::uart_cfg[uart_n].pair_port;
+    int64_t t_window_us =
+        (int64_t)(ns_device::ns_uart::uart_cfg[uart_n].pair_window_ms) *
+        1000;
+
+    while (true)
+    {
+        int64_t t_us = 0;
+        int64_t t_pair_us = 0;
+        bool queued = pair_head_time(uart_n, &t_us);
+        bool pair_queued = pair_head_time(pair_n, &t_pair_us);
+
+        if (queued && pair_queued)
+        {
+            if (t_pair_us < t_us)
+            {   pair_pop(pair_n);   }
+            else
+            {   pair_pop(uart_n);   }
+            continue;
+        }
+
+        if (queued)
+        {
+            if ( (flush == false) &&
+                 (esp_timer_get_time() - t_us < t_window_us) )
+            {   return;   }
+            pair_pop(uart_n);
+            continue;
+        }
+
+        if (pair_queued)
+        {
+            if ( (flush == false) &&
+                 (esp_timer_get_time() - t_pair_us < t_window_us) )
+            {   return;   }
+            pair_pop(pair_n);
+            continue;
+        }
+
+        return;
+    }
+}
+
+/**
+ * @details This function reads the timestamp field of the oldest record of
+ * the Port pair queue (little endian).
+ */
+bool InterfaceUART::pair_head_time(const uint8_t uart_n, int64_t* t_us)
+{
+    if ( (uart_n == 0U) || (pair_head[uart_n] == pair_tail[uart_n]) )
+    {   return false;   }
+
+    const uint8_t* record = &(pair_data[uart_n][pair_head[uart_n]]);
+    uint64_t t = 0U;
+    for (uint8_t i = 0U; i < 8U; i++)
+    {   t = t | ((uint64_t)(record[1U + i]) << (8U * i));   }
+    *t_us = (int64_t)(t);
+
+    return true;
+}
+
+/**
+ * @details This function gets the size of the oldest record of the Port pair
+ * queue from its length fields, publishes it through the primary Port of the
+ * pair and removes it from the queue.
+ */
+void InterfaceUART::pair_pop(const uint8_t uart_n)
+{
+    uint8_t pair_n = ns_device::ns_uart::uart_cfg[uart_n].pair_port;
+    uint8_t primary_n = ( (pair_n != 0U) && (pair_n < uart_n) ) ?
+        pair_n : uart_n;
+    const uint8_t* record = &(pair_data[uart_n][pair_head[uart_n]]);
+
+    uint32_t size = RX_RECORD_HEADER_SIZE +
+        ((uint32_t)(record[9]) | ((uint32_t)(record[10]) << 8));
+    if ((record[0] & RX_RECORD_FLAG_DELTAS) != 0U)
+    {
+        uint32_t num_deltas = (uint32_t)(record[size]) |
+            ((uint32_t)(record[size + 1U]) << 8);
+        size = size + 2U + (2U * num_deltas);
+    }
+
+    publish_record(primary_n, record, size);
+
+    pair_head[uart_n] = pair_head[uart_n] + size;
+    if (pair_head[uart_n] >= pair_tail[uart_n])
+    {
+        pair_head[uart_n] = 0U;
+        pair_tail[uart_n] = 0U;
+    }
+}
+
+/**
+ * @details This function publishes the pending batch of the Port (if any)
+ * and starts a new empty one.
+ */
+bool InterfaceUART::batch_flush(const uint8_t uart_n)
+{
+    if (batch_len[uart_n] == 0U)
+    {   return false;   }
+
+    uint32_t len = batch_len[uart_n];
+    batch_len[uart_n] = 0U;
+
+    return mqtt_publish_rx(uart_n, batch_data[uart_n], len);
+}
+
+/**
+ * @details This function compares the FNV-1a hash and length of the frame
+ * with the ones of the last published frame. A frame equal to it that arrives
+ * within the collapsing window since the previous equal one is counted as a
+ * repetition and suppressed. Any other frame publishes the pending summary of
+ * repetitions first and becomes the new reference frame.
+ */
+bool InterfaceUART::dedup_check(const uint8_t uart_n, const uint8_t* frame,
+        const uint32_t len)
+{
+    using namespace ns_device::ns_uart;
+
+    uint32_t window_ms = uart_cfg[uart_n].dedup_ms;
+
+    // Do nothing if collapsing is disabled
+    if (window_ms == 0U)
+    {   return false;   }
+
+    uint32_t hash = 2166136261U;
+    for (uint32_t i = 0U; i < len; i++)
+    {   hash = (hash ^ frame[i]) * 16777619U;   }
+
+    unsigned long t_now = millis();
+    if ( (len != 0U) && (len == dedup_len[uart_n]) &&
+         (hash == dedup_hash[uart_n]) &&
+         (t_now - t_dedup_last[uart_n] < window_ms) )
+    {
+        int64_t t_us = t_frame_us[uart_n];
+        if (uart_cfg[uart_n].timestamps == t_uart_timestamps::OFF)
+        {   t_us = esp_timer_get_time();   }
+        if (dedup_count[uart_n] == 0U)
+        {
+            t_dedup_start[uart_n] = t_now;
+            t_dedup_first_us[uart_n] = t_us;
+        }
+        t_dedup_last_us[uart_n] = t_us;
+        t_dedup_last[uart_n] = t_now;
+        dedup_count[uart_n] = dedup_count[uart_n] + 1U;
+        dedup_num_suppressed[uart_n] = dedup_num_suppressed[uart_n] + 1U;
+        return true;
+    }
+
+    dedup_flush(uart_n);
+    dedup_hash[uart_n] = hash;
+    dedup_len[uart_n] = len;
+    t_dedup_last[uart_n] = t_now;
+
+    return false;
+}
+
+/**
+ * @details This function publishes the pending repetitions of the Port
+ * through the frames path with the repeat flag (so it is batched and merged
+ * with pairs as any other record, and never filtered or collapsed):
+ * - Timestamped frames: A record with the time of the first repetition and
+ *   the number of repetitions (4 bytes) and time of the last one (8 bytes) as
+ *   data, both little endian.
+ * - Raw frames: A "repeated N times (first T us, last T us)" text frame.
+ * The frame timestamp in progress is preserved.
+ */
+bool InterfaceUART::dedup_flush(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing if there are no repetitions pending
+    if (dedup_count[uart_n] == 0U)
+    {   return false;   }
+
+    uint8_t summary[DEDUP_SUMMARY_LEN];
+    uint32_t len = 0U;
+    int64_t t_frame = t_frame_us[uart_n];
+    uint32_t num_deltas = num_frame_deltas[uart_n];
+    uint32_t count = dedup_count[uart_n];
+    uint64_t t_last = (uint64_t)(t_dedup_last_us[uart_n]);
+
+    if (uart_cfg[uart_n].timestamps != t_uart_timestamps::OFF)
+    {
+        for (uint8_t i = 0U; i < 4U; i++)
+        {   summary[i] = (uint8_t)((count >> (8U * i)) & 0xFFU);   }
+        for (uint8_t i = 0U; i < 8U; i++)
+        {   summary[4U + i] = (uint8_t)((t_last >> (8U * i)) & 0xFFU);   }
+        len = 12U;
+    }
+    else
+    {
+        int n = snprintf((char*)(summary), DEDUP_SUMMARY_LEN,
+            "repeated %" PRIu32 " times (first %" PRId64 " us, "
+            "last %" PRId64 " us)", count, t_dedup_first_us[uart_n],
+            t_dedup_last_us[uart_n]);
+        if (n > 0)
+        {   len = (uint32_t)(n);   }
+        if (len >= DEDUP_SUMMARY_LEN)
+        {   len = DEDUP_SUMMARY_LEN - 1U;   }
+    }
+
+    dedup_count[uart_n] = 0U;
+    t_frame_us[uart_n] = t_dedup_first_us[uart_n];
+    num_frame_deltas[uart_n] = 0U;
+    uint8_t flags = rx_record_flags[uart_n];
+    rx_record_flags[uart_n] = RX_RECORD_FLAG_REPEAT;
+    bool published = publish_frame(uart_n, summary, len);
+    rx_record_flags[uart_n] = flags;
+    t_frame_us[uart_n] = t_frame;
+    num_frame_deltas[uart_n] = num_deltas;
+
+    return published;
+}
+
+/**
+ * @details This function encodes the line with the Port template miner (or
+ * as is, for raw repeated frames summaries), publishes the templates if they
+ * have changed so they are sent before the lines that use them, and then
+ * publishes the encoded line through the frames path with the template flag
+ * (so it is batched and merged with pairs as any other record).
+ */
+bool InterfaceUART::publish_template(const uint8_t uart_n,
+        const uint8_t* frame, const uint32_t len)
+{
+    uint8_t flags = rx_record_flags[uart_n];
+    uint32_t encoded_len = 0U;
+    if (flags == 0U)
+    {
+        encoded_len = rx_templates[uart_n].encode(frame, len,
+            tpl_data[uart_n], TPL_DATA_SIZE);
+    }
+    else
+    {
+        encoded_len = rx_templates[uart_n].encode_raw(frame, len,
+            tpl_data[uart_n], TPL_DATA_SIZE);
+    }
+    if (encoded_len == 0U)
+    {   return false;   }
+
+    handle_templates(uart_n);
+
+    rx_record_flags[uart_n] = flags | RX_RECORD_FLAG_TEMPLATE;
+    bool published = publish_frame(uart_n, tpl_data[uart_n], encoded_len);
+    rx_record_flags[uart_n] = flags;
+
+    return published;
+}
+
+/**
+ * @details This function publishes the templates of the Port as a retained
+ * text message with a "ID template" line per template, so a subscriber gets
+ * the current templates as soon as it subscribes. The message is streamed
+ * template by template (it can be larger than the MQTT buffer). The
+ * templates are kept as changed to retry later if the publish fails.
+ */
+void InterfaceUART::handle_templates(const uint8_t uart_n)
+{
+    UARTTemplates* templates = &(rx_templates[uart_n]);
+
+    // Do nothing if the templates have not changed
+    if (templates->is_changed() == false)
+    {   return;   }
+
+    // Get the message length
+    char id_str[8];
+    uint16_t id = 0U;
+    const uint8_t* text = nullptr;
+    size_t length = 0U;
+    for (uint8_t i = 0U; i < templates->get_num_templates(); i++)
+    {
+        uint32_t text_len = templates->get_template(i, &id, &text);
+        length = length + (size_t)(snprintf(id_str, sizeof(id_str),
+            "%" PRIu16 " ", id)) + text_len + 1U;
+    }
+
+    if (MQTT.publish_begin(topic_templates[uart_n], length, true) == false)
+    {   return;   }
+    bool publish_ok = true;
+    for (uint8_t i = 0U; i < templates->get_num_templates(); i++)
+    {
+        uint32_t text_len = templates->get_template(i, &id, &text);
+        int id_len = snprintf(id_str, sizeof(id_str), "%" PRIu16 " ", id);
+        publish_ok = publish_ok &&
+            MQTT.publish_write((const uint8_t*)(id_str), (size_t)(id_len)) &&
+            MQTT.publish_write(text, text_len) &&
+            MQTT.publish_write((const uint8_t*)("\n"), 1U);
+    }
+    if (MQTT.publish_end() && publish_ok)
+    {   templates->set_published();   }
+}
+
+/**
+ * @details This function checks the detection in progress of an UART Port,
+ * and configures the Port with the detected speed (the result is reported
+ * on the status message).
+ */
+void InterfaceUART::handle_autobaud(const uint8_t uart_n)
+{
+    // Do nothing if the detection is not finished
+    if (autobaud[uart_n].poll() == false)
+    {   return;   }
+
+    if (autobaud[uart_n].get_state() == UARTAutobaud::t_state::DETECTED)
+    {   uart_config_speed(uart_n, autobaud[uart_n].get_rate());   }
+}
+
+/**
+ * @details This function updates the overload state of an UART Port with
+ * its capture counters and Rx ring buffer fill, and applies its policy:
+ * - Drop oldest: When the backlog reaches the high fill mark, the oldest Rx
+ *   data is discarded down to the low fill mark (with the partial frame).
+ * - Drop newest: The capture discards the data that can't be stored at once
+ *   (instead of keeping it in the UART Driver).
+ * - Summary: The Rx frames are only counted (see publish_frame()).
+ * - Pause: The capture is paused when the backlog reaches the high fill mark
+ *   and resumed when it goes under the low fill mark.
+ * The overload transitions, and each measure window while overloaded, are
+ * reported on the status topic.
+ */
+void InterfaceUART::handle_overload(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return;   }
+
+    // Do nothing if the UART Port was not enabled or has no overload policy
+    if ( (uart_cfg[uart_n].enable == false) ||
+         (uart_cfg[uart_n].overload == t_uart_overload::OFF) )
+    {   return;   }
+
+    // Do nothing if the Port has no Rx ring buffer
+    UARTRingBuffer* ring = &(rx_ring[uart_n]);
+    uint32_t size = ring->size();
+    if (size == 0U)
+    {   return;   }
+
+    t_uart_overload policy = uart_cfg[uart_n].overload;
+    uint32_t fill_pct = (uint32_t)(((uint64_t)(ring->available()) * 100U) /
+        size);
+    UARTOverload::t_event event = overload[uart_n].update(millis(),
+        ring->get_write_count(), ring->get_num_dropped(), fill_pct);
+    bool overloaded = overload[uart_n].is_overloaded();
+
+    // Discard the oldest Rx data down to the low fill mark
+    if ( overloaded && (policy == t_uart_overload::DROP_OLDEST) &&
+         (fill_pct >= UARTOverload::HIGH_FILL_PCT) )
+    {
+        uint32_t num_keep = (size * UARTOverload::LOW_FILL_PCT) / 100U;
+        uint32_t num_drop = ring->available() - num_keep;
+        overload[uart_n].add_dropped(num_drop + framer[uart_n].get_length());
+        framer[uart_n].reset();
+        ring->consume(num_drop);
+        rx_marks[uart_n].release(ring->get_read_count());
+    }
+
+    // Discard the newest Rx data at capture
+    bool discard = overloaded && (policy == t_uart_overload::DROP_NEWEST);
+    if (discard != rx_discard[uart_n])
+    {
+        rx_discard[uart_n] = discard;
+        Capture.set_discard(uart_n, discard);
+    }
+
+    // Pause the capture with hysteresis
+    bool pause = rx_pause[uart_n];
+    if ( (overloaded == false) || (policy != t_uart_overload::PAUSE) )
+    {   pause = false;   }
+    else if (fill_pct >= UARTOverload::HIGH_FILL_PCT)
+    {   pause = true;   }
+    else if (fill_pct <= UARTOverload::LOW_FILL_PCT)
+    {   pause = false;   }
+    if (pause != rx_pause[uart_n])
+    {
+        rx_pause[uart_n] = pause;
+        Capture.set_pause(uart_n, pause);
+    }
+
+    if (event != UARTOverload::t_event::NONE)
+    {   mqtt_send_uart_overload_info(uart_n, event);   }
+}
+
+/**
+ * @details This function resumes the capture of the Port and stops the
+ * discard of its data, and restarts its overload measure from the current
+ * capture counters (reporting the end of the overload if it was overloaded).
+ */
+void InterfaceUART::overload_reset(const uint8_t uart_n)
+{
+    rx_pause[uart_n] = false;
+    rx_discard[uart_n] = false;
+    Capture.set_pause(uart_n, false);
+    Capture.set_discard(uart_n, false);
+
+    bool was_overloaded = overload[uart_n].is_overloaded();
+    overload[uart_n].reset(millis(), rx_ring[uart_n].get_write_count(),
+        rx_ring[uart_n].get_num_dropped());
+    if (was_overloaded)
+    {
+        mqtt_send_uart_overload_info(uart_n,
+            UARTOverload::t_event::EXIT);
+    }
+}
+
+/**
+ * @details This function flushes the protocol decoder of an UART Port with
+ * the current time, so the records that wait for a timeout are published.
+ */
+void InterfaceUART::handle_decoder(const uint8_t uart_n)
+{
+    // Do nothing if the Port has no decoder
+    if (decoder[uart_n] == nullptr)
+    {   return;   }
+
+    decoder[uart_n]->set_char_time(uart_char_time_us(uart_n));
+    decoder[uart_n]->flush(esp_timer_get_time());
+}
+
+/**
+ * @details This function publishes the record as a binary message to the
+ * decoder topic of the Port, followed by the record subtopic if any (i.e.
+ * the Modbus RTU slave address).
+ */
+bool InterfaceUART::decoder_sink(void* ctx, const char* subtopic,
+        const uint8_t* record, const uint32_t len)
+{
+    const char* topic = (const char*)(ctx);
+    if (subtopic == nullptr)
+    {   return MQTT.publish(topic, record, len);   }
+
+    char topic_sub[ns_const::MQTT_TOPIC_MAX_LEN];
+    snprintf(topic_sub, sizeof(topic_sub), "%s/%s", topic, subtopic);
+
+    return MQTT.publish(topic_sub, record, len);
+}
+
+/**
+ * @details This function publishes the pending repetitions summary of the
+ * Port when the collapsing window has elapsed since the first repetition, so
+ * a summary is never delayed more than the window.
+ */
+void InterfaceUART::handle_dedup_timeout(const uint8_t uart_n)
+{
+    if (dedup_count[uart_n] == 0U)
+    {   return;   }
+
+    using namespace ns_device::ns_uart;
+
+    uint32_t window_ms = uart_cfg[uart_n].dedup_ms;
+    if (millis() - t_dedup_start[uart_n] >= window_ms)
+    {   dedup_flush(uart_n);   }
+}
+
+/**
+ * @details This function checks the time that the oldest frame has been
+ * waiting in the Port batch and publish it if the batch maximum latency has
+ * been reached.
+ */
+void InterfaceUART::handle_batch_timeout(const uint8_t uart_n)
+{
+    if (batch_len[uart_n] == 0U)
+    {   return;   }
+
+    using namespace ns_device::ns_uart;
+
+    uint32_t batch_ms = (uint32_t)(uart_cfg[uart_n].batch_ms);
+    if (millis() - t_batch_start[uart_n] >= batch_ms)
+    {   batch_flush(uart_n);   }
+}
+
+/**
+ * @details This function gets the line settings of the Port from its Global
+ * uart_cfg configuration. Unset Rx/Tx GPIOs are resolved to the Port default
+ * ones, and the Rx buffer and FIFO threshold are taken from the selected
+ * capture profile.
+ */
+void InterfaceUART::get_line_settings(const uint8_t uart_n,
+        UARTCapture::s_line* line)
+{
+    using namespace ns_device::ns_uart;
+
+    s_uart_config* cfg = &(uart_cfg[uart_n]);
+
+    line->config = cfg->config;
+    line->config.baud_rate = (int)(cfg->bauds);
+
+    // Default Serial Port pins
+    line->rx_pin = UART_PIN_NO_CHANGE;
+    line->tx_pin = UART_PIN_NO_CHANGE;
+    #if SOC_UART_NUM > 1
+        if (uart_n == 1U)
+        {   line->rx_pin = RX1; line->tx_pin = TX1;   }
+    #endif
+    #if (SOC_UART_NUM > 2) && defined(RX2) && defined(TX2)
+        if (uart_n == 2U)
+        {   line->rx_pin = RX2; line->tx_pin = TX2;   }
+    #endif
+    if (cfg->rx_pin >= 0)
+    {   line->rx_pin = (int)(cfg->rx_pin);   }
+    if (cfg->tx_pin >= 0)
+    {   line->tx_pin = (int)(cfg->tx_pin);   }
+
+    // Flow control pins (only the ones used by the mode)
+    line->rts_pin = UART_PIN_NO_CHANGE;
+    line->cts_pin = UART_PIN_NO_CHANGE;
+    if ( (cfg->config.flow_ctrl == UART_HW_FLOWCTRL_RTS) ||
+         (cfg->config.flow_ctrl == UART_HW_FLOWCTRL_CTS_RTS) )
+    {   line->rts_pin = (int)(cfg->rts_pin);   }
+    if ( (cfg->config.flow_ctrl == UART_HW_FLOWCTRL_CTS) ||
+         (cfg->config.flow_ctrl == UART_HW_FLOWCTRL_CTS_RTS) )
+    {   line->cts_pin = (int)(cfg->cts_pin);   }
+
+    // UART Driver Rx buffer sized for the Port speed, to hold the data
+    // received during a publish stall (the Poll engine reads the driver from
+    // process())
+    uint32_t driver_size = rx_stall_size(uart_n, MAX_DRIVER_RX_BUFFER_SIZE);
+    if (driver_size < MIN_DRIVER_RX_BUFFER_SIZE)
+    {   driver_size = MIN_DRIVER_RX_BUFFER_SIZE;   }
+    line->driver_rx_buffer_size = (int)(driver_size);
+
+    // Capture profile
+    line->rx_full_thresh = RX_FIFO_FULL_THRESH;
+    if (cfg->high_speed)
+    {   line->rx_full_thresh = HS_RX_FIFO_FULL_THRESH;   }
+    if (cfg->bridge_port != 0U)
+    {   line->rx_full_thresh = BRIDGE_RX_FIFO_FULL_THRESH;   }
+}
+
+/**
+ * @details This function calculates the time of an UART character
+ * (start + data + parity + stop bits) at the Port configured speed.
+ */
+uint32_t InterfaceUART::uart_char_time_us(const uint8_t uart_n)
+{
+    const uart_config_t* config =
+        &(ns_device::ns_uart::uart_cfg[uart_n].config);
+    uint32_t bauds = ns_device::ns_uart::uart_cfg[uart_n].bauds;
+    if (bauds == 0U)
+    {   bauds = ns_const::DEFAULT_UART_BAUD_RATE;   }
+
+    // Start bit + data bits (5 to 8) + parity bit + stop bits (1.5 as 2)
+    uint32_t char_bits = 1U + 5U + (uint32_t)(config->data_bits);
+    if (config->parity != UART_PARITY_DISABLE)
+    {   char_bits = char_bits + 1U;   }
+    char_bits = char_bits +
+        ((config->stop_bits == UART_STOP_BITS_1) ? 1U : 2U);
+
+    return ((char_bits * 1000000U) + bauds - 1U) / bauds;
+}
+
+/**
+ * @details This function configures the UART hardware Rx timeout of the Port
+ * capture engine, so in IDLE framing the received data is delivered as soon
+ * as the inter-byte silence is detected. Bridged Ports use the minimum timeout
+ * to forward the received data as soon as possible.
+ */
+void InterfaceUART::apply_rx_timeout(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    uint8_t rx_timeout = DEFAULT_RX_TIMEOUT_CHARS;
+    if (uart_cfg[uart_n].framing == t_uart_framing::IDLE)
+    {   rx_timeout = uart_cfg[uart_n].frame_idle_chars;   }
+    if (uart_cfg[uart_n].bridge_port != 0U)
+    {   rx_timeout = BRIDGE_RX_TIMEOUT_CHARS;   }
+
+    if (uart_cfg[uart_n].engine == t_uart_engine::EVENT)
+    {
+        if (Capture.is_running(uart_n))
+        {   uart_set_rx_timeout((uart_port_t)(uart_n), rx_timeout);   }
+    }
+    else if (SerialPort[uart_n] != nullptr)
+    {   SerialPort[uart_n]->setRxTimeout(rx_timeout);   }
+}
+
+/**
+ * @details This function moves the data received by each enabled Poll engine
+ * Serial Port directly into the free regions of its Rx ring buffer, marking
+ * the arrival time of each read chunk. If the ring buffer is full, the data
+ * is kept in the Serial Port buffer, unless the overload policy of the Port
+ * discards it. A paused Port keeps it there too if it has RTS flow control,
+ * otherwise it is discarded.
+ */
+void InterfaceUART::capture_poll()
+{
+    using namespace ns_device::ns_uart;
+
+    for (uint8_t i = 1U; i < ns_const::MAX_NUM_UART; i++)
+    {
+        if ( (uart_cfg[i].enable == false) ||
+             (uart_cfg[i].engine != t_uart_engine::POLL) ||
+             (SerialPort[i] == nullptr) )
+        {   continue;   }
+
+        // A paused Port keeps the data in the Serial Port if the RTS flow
+        // control can hold the sender
+        if ( rx_pause[i] &&
+             ((uart_cfg[i].config.flow_ctrl & UART_HW_FLOWCTRL_RTS) != 0) )
+        {   continue;   }
+
+        int num_available = SerialPort[i]->available();
+        while (num_available > 0)
+        {
+            uint8_t* ptr = nullptr;
+            uint32_t region = 0U;
+            if (rx_pause[i] == false)
+            {   region = rx_ring[i].write_region(&ptr);   }
+
+            // Discard the data that can't be stored (paused or discard
+            // mode Port), accounting it as dropped
+            if (region == 0U)
+            {
+                if ( (rx_pause[i] == false) && (rx_discard[i] == false) )
+                {   break;   }
+
+                uint8_t discard[POLL_DISCARD_CHUNK_SIZE];
+                uint32_t to_read = POLL_DISCARD_CHUNK_SIZE;
+                if ((uint32_t)(num_available) < to_read)
+                {   to_read = (uint32_t)(num_available);   }
+                uint32_t num_read = (uint32_t)(SerialPort[i]->read(discard,
+                    (size_t)(to_read)));
+                if (num_read == 0U)
+                {   break;   }
+                rx_ring[i].drop(num_read);
+                num_available = num_available - (int)(num_read);
+                continue;
+            }
+
+            if ((uint32_t)(num_available) < region)
+            {   region = (uint32_t)(num_available);   }
+            uint32_t num_read = (uint32_t)(SerialPort[i]->read(ptr,
+                (size_t)(region)));
+            if (num_read == 0U)
+            {   break;   }
+            rx_ring[i].write_commit(num_read);
+            rx_marks[i].push(rx_ring[i].get_write_count(),
+                esp_timer_get_time());
+
+            num_available = num_available - (int)(num_read);
+        }
+    }
+}
+
+/**
+ * @details This function moves the Tx queue data of a Poll engine Port to the
+ * Serial Port, only as much as it can take without blocking (the rest is sent
+ * in next calls). For the Event-Driven engine the capture task does it. Then
+ * the pending Tx echoes batch is published if its latency has elapsed.
+ */
+void InterfaceUART::handle_uart_tx(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return;   }
+
+    if ( (uart_cfg[uart_n].enable) &&
+         (uart_cfg[uart_n].engine == t_uart_engine::POLL) &&
+         (SerialPort[uart_n] != nullptr) )
+    {
+        const uint8_t* ptr = nullptr;
+        uint32_t region = tx_ring[uart_n].read_region(&ptr);
+        while (region > 0U)
+        {
+            int num_free = SerialPort[uart_n]->availableForWrite();
+            if (num_free <= 0)
+            {   break;   }
+            if ((uint32_t)(num_free) < region)
+            {   region = (uint32_t)(num_free);   }
+
+            uint32_t num_sent = (uint32_t)(SerialPort[uart_n]->write(ptr,
+                (size_t)(region)));
+            if (num_sent == 0U)
+            {   break;   }
+            tx_ring[uart_n].consume(num_sent);
+            region = tx_ring[uart_n].read_region(&ptr);
+        }
+    }
+
+    if ( (tx_echo_len[uart_n] > 0U) &&
+         (millis() - t_tx_echo_start[uart_n] >= T_TX_ECHO_BATCH_MS) )
+    {   tx_echo_flush(uart_n);   }
+}
+
+/**
+ * @details This function keeps the TCP serial server of the Port listening
+ * while the Port is enabled with a TCP port configured and the network is
+ * available (closing it otherwise, as its sockets don't survive a network
+ * loss). A failed start is retried after some time. The client data is
+ * received directly into the free region of the Tx queue, so if the queue is
+ * full the data stays in the socket and TCP flow control slows down the
+ * client. Bridged Ports don't take the client data (their Tx is used by the
+ * bridge).
+ */
+void InterfaceUART::handle_uart_tcp(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    // Do nothing for UART0 that is used as device CLI
+    if (uart_n == 0U)
+    {   return;   }
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return;   }
+
+    UARTTCPServer* server = &(tcp_server[uart_n]);
+    if ( (uart_cfg[uart_n].enable == false) ||
+         (uart_cfg[uart_n].tcp_port == 0U) ||
+         (Network.available() == false) )
+    {
+        if (server->is_listening())
+        {   server->stop();   }
+        return;
+    }
+
+    if (server->is_listening() == false)
+    {
+        if (millis() - t_tcp_start[uart_n] < T_TCP_RETRY_MS)
+        {   return;   }
+        t_tcp_start[uart_n] = millis();
+        if (server->start(uart_cfg[uart_n].tcp_port) == false)
+        {   return;   }
+    }
+    server->accept_client();
+
+    // Move the client data to the Tx queue
+    if ( (server->is_connected() == false) ||
+         (uart_cfg[uart_n].bridge_port != 0U) )
+    {   return;   }
+    uint8_t* ptr = nullptr;
+    uint32_t region = tx_ring[uart_n].write_region(&ptr);
+    uint32_t num_received = server->receive(ptr, region);
+    if (num_received == 0U)
+    {   return;   }
+    tx_ring[uart_n].write_commit(num_received);
+    if (uart_cfg[uart_n].engine == t_uart_engine::EVENT)
+    {   Capture.notify_tx(uart_n);   }
+}
+
+/**
+ * @details This function fires the flight recorder trigger of the Port if its
+ * GPIO edge was detected, and publishes the next chunk of a pending dump on
+ * the recorder topic (one chunk per call, so the dump doesn't stall the
+ * other Ports). Each chunk is prefixed with a header (little endian): dump
+ * number (2 bytes), offset of the chunk data in the dump (4 bytes), dump
+ * length (4 bytes) and trigger position in the dump (4 bytes). The chunks
+ * are cut at the history buffer wrap, so they don't all have the same size.
+ * The chunk is retried in the next call if it can't be published.
+ */
+void InterfaceUART::handle_recorder(const uint8_t uart_n)
+{
+    UARTRecorder* rec = &(recorder[uart_n]);
+
+    // Do nothing if the recorder is disabled
+    if (rec->get_state() == UARTRecorder::t_state::OFF)
+    {   return;   }
+
+    if (rec_gpio_fired[uart_n])
+    {
+        rec_gpio_fired[uart_n] = false;
+        rec->trigger();
+    }
+
+    const uint8_t* ptr = nullptr;
+    uint32_t region = rec->dump_region(&ptr);
+    if (region == 0U)
+    {   return;   }
+    if (region > REC_CHUNK_SIZE)
+    {   region = REC_CHUNK_SIZE;   }
+
+    uint8_t header[REC_CHUNK_HEADER_SIZE];
+    uint16_t dump_n = (uint16_t)(rec->get_num_dumps());
+    uint32_t chunk_pos = rec->get_dump_pos();
+    uint32_t dump_len = rec->get_dump_length();
+    uint32_t trigger_pos = rec->get_trigger_pos();
+    header[0] = (uint8_t)(dump_n & 0xFFU);
+    header[1] = (uint8_t)((dump_n >> 8) & 0xFFU);
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        header[2U + i] = (uint8_t)((chunk_pos >> (8U * i)) & 0xFFU);
+        header[6U + i] = (uint8_t)((dump_len >> (8U * i)) & 0xFFU);
+        header[10U + i] = (uint8_t)((trigger_pos >> (8U * i)) & 0xFFU);
+    }
+
+    if (MQTT.publish(topic_rec[uart_n], header, REC_CHUNK_HEADER_SIZE, ptr,
+            region))
+    {   rec->dump_consume(region);   }
+}
+
+/**
+ * @details This function writes the data into the Port Tx queue (the caller
+ * has checked that it fits) and wakes up the Event-Driven capture task to
+ * transmit it. The Poll engine transmits it from process().
+ */
+void InterfaceUART::uart_tx_queue(const uint8_t uart_n, const uint8_t* data,
+        const uint32_t size)
+{
+    using namespace ns_device::ns_uart;
+
+    tx_ring[uart_n].write(data, size);
+
+    if (uart_cfg[uart_n].engine == t_uart_engine::EVENT)
+    {   Capture.notify_tx(uart_n);   }
+}
+
+/**
+ * @details This function copies the Tx message into the Port echo buffer
+ * (the message may be in the MQTT Client buffer that is overwritten on
+ * publish), truncated to the echo maximum size:
+ * - ON mode: The echo is published immediately.
+ * - BATCH mode: The echoes are joined with a line feed and published when
+ *   the next one doesn't fit or its latency has elapsed.
+ */
+void InterfaceUART::tx_echo(const uint8_t uart_n, const uint8_t* data,
+        uint32_t len)
+{
+    using namespace ns_device::ns_uart;
+
+    t_uart_tx_echo mode = uart_cfg[uart_n].tx_echo;
+    if ( (mode == t_uart_tx_echo::OFF) || (tx_echo_data[uart_n] == nullptr) )
+    {   return;   }
+
+    if (len > MAX_TX_ECHO_SIZE)
+    {   len = MAX_TX_ECHO_SIZE;   }
+
+    // Publish pending echoes if the new one doesn't fit
+    uint32_t separator = (tx_echo_len[uart_n] > 0U) ? 1U : 0U;
+    if (tx_echo_len[uart_n] + separator + len > MAX_TX_ECHO_SIZE)
+    {
+        tx_echo_flush(uart_n);
+        separator = 0U;
+    }
+
+    uint8_t* ptr_echo = &(tx_echo_data[uart_n][tx_echo_len[uart_n]]);
+    if (separator > 0U)
+    {   ptr_echo[0] = (uint8_t)('\n');   }
+    else
+    {   t_tx_echo_start[uart_n] = millis();   }
+    memcpy(&(ptr_echo[separator]), data, len);
+    tx_echo_len[uart_n] = tx_echo_len[uart_n] + separator + len;
+
+    if (mode == t_uart_tx_echo::ON)
+    {   tx_echo_flush(uart_n);   }
+}
+
+/**
+ * @details This function publishes the pending Tx echo of the Port (if any).
+ */
+bool InterfaceUART::tx_echo_flush(const uint8_t uart_n)
+{
+    if (tx_echo_len[uart_n] == 0U)
+    {   return false;   }
+
+    uint32_t len = tx_echo_len[uart_n];
+    tx_echo_len[uart_n] = 0U;
+
+    return mqtt_publish_tx(uart_n, tx_echo_data[uart_n], len);
+}
+
+/**
+ * @details This function (re)starts the capture engine configured for the
+ * UART Port with its current line settings. The Event-Driven engine installs
+ * the UART Driver and launch a capture task, while the Poll engine begins the
+ * Arduino Serial Port (that is read from process()) with a reception errors
+ * callback to report the line events.
+ */
+bool InterfaceUART::capture_start(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    // Stop any running capture and clear its data
+    capture_stop(uart_n);
+    tx_ring[uart_n].consume(tx_ring[uart_n].available());
+    framer[uart_n].reset();
+    rx_ring[uart_n].consume(rx_ring[uart_n].available());
+    rx_marks[uart_n].release(rx_ring[uart_n].get_read_count());
+    rx_events[uart_n].reset();
+
+    // Get the Rx memory for the Port speed, the Tx queue memory and the
+    // buffers of the Port features
+    if ( (rx_memory_alloc(uart_n) == false) ||
+         (tx_memory_alloc(uart_n) == false) ||
+         (port_memory_alloc(uart_n) == false) )
+    {   return false;   }
+    overload_reset(uart_n);
+
+    UARTCapture::s_line line;
+    get_line_settings(uart_n, &line);
+
+    if (uart_cfg[uart_n].engine == t_uart_engine::EVENT)
+    {
+        if (Capture.start(uart_n, &line, &(rx_ring[uart_n]),
+                &(rx_marks[uart_n]), &(tx_ring[uart_n]),
+                &(rx_events[uart_n])) == false)
+        {   return false;   }
+        apply_rx_timeout(uart_n);
+        return true;
+    }
+
+    // Do nothing if there is no Serial Port for the Poll engine
+    if (SerialPort[uart_n] == nullptr)
+    {   return false;   }
+
+    // Arduino Serial configuration (SERIAL_8N1 like value)
+    uint32_t serial_config = SERIAL_CONFIG_BASE |
+        ((uint32_t)(line.config.data_bits) << 2) |
+        ((uint32_t)(line.config.stop_bits) << 4) |
+        (uint32_t)(line.config.parity);
+
+    SerialPort[uart_n]->setRxBufferSize((size_t)(line.driver_rx_buffer_size));
+    SerialPort[uart_n]->onReceiveError(
+        [this, uart_n](hardwareSerial_error_t error)
+        {   poll_line_event(uart_n, error);   });
+    SerialPort[uart_n]->begin((unsigned long)(line.config.baud_rate),
+        serial_config, (int8_t)(line.rx_pin), (int8_t)(line.tx_pin), false,
+        20000UL, line.rx_full_thresh);
+    uart_enable_intr_mask((uart_port_t)(uart_n), UART_INTR_FRAM_ERR);
+    if (line.config.flow_ctrl != UART_HW_FLOWCTRL_DISABLE)
+    {
+        SerialPort[uart_n]->setPins((int8_t)(line.rx_pin),
+            (int8_t)(line.tx_pin), (int8_t)(line.cts_pin),
+            (int8_t)(line.rts_pin));
+        SerialPort[uart_n]->setHwFlowCtrlMode(
+            (uint8_t)(line.config.flow_ctrl),
+            line.config.rx_flow_ctrl_thresh);
+    }
+    apply_rx_timeout(uart_n);
+
+    return true;
+}
+
+/**
+ * @details This function gets the configured Rx ring buffer size of the Port,
+ * or if it is not configured, the number of bytes received at the Port speed
+ * (character time) during the publish stall time. The size is rounded up to
+ * a power of two within the ring buffer size limits.
+ */
+uint32_t InterfaceUART::rx_ring_size(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    uint32_t size = uart_cfg[uart_n].rx_buffer_size;
+    if (size == 0U)
+    {   size = rx_stall_size(uart_n, ns_const::MAX_UART_RX_BUFFER_SIZE);   }
+
+    uint32_t ring_size = ns_const::MIN_UART_RX_BUFFER_SIZE;
+    while ( (ring_size < size) &&
+            (ring_size < ns_const::MAX_UART_RX_BUFFER_SIZE) )
+    {   ring_size = ring_size << 1U;   }
+
+    return ring_size;
+}
+
+/**
+ * @details This function calculates the number of bytes received at the Port
+ * speed (character time) during the publish stall time of the Port.
+ */
+uint32_t InterfaceUART::rx_stall_size(const uint8_t uart_n,
+        const uint32_t max_size)
+{
+    uint64_t stall_us =
+        (uint64_t)(ns_device::ns_uart::uart_cfg[uart_n].rx_stall_ms) * 1000U;
+    uint64_t num_bytes = stall_us / uart_char_time_us(uart_n);
+
+    return (num_bytes > max_size) ? max_size : (uint32_t)(num_bytes);
+}
+
+/**
+ * @details This function allocates a single block for the Port Rx ring
+ * buffer and framer buffer (from PSRAM on boards that have it, so big ring
+ * buffers don't use the internal RAM). The memory is kept if it already has
+ * the required size, so the ring buffer statistics survive restarts. If
+ * there is not enough free memory, the ring buffer size is halved down to
+ * its minimum size. The templates table of a Port with template encoding
+ * configured is allocated too (templates are learned again from scratch).
+ */
+bool InterfaceUART::rx_memory_alloc(const uint8_t uart_n)
+{
+    uint32_t ring_size = rx_ring_size(uart_n);
+
+    if ( ns_device::ns_uart::uart_cfg[uart_n].templates &&
+         (rx_templates[uart_n].is_enabled() == false) )
+    {
+        if (rx_templates[uart_n].configure(true) == false)
+        {   return false;   }
+    }
+
+    // Do nothing if the current memory has the required size
+    if ( (rx_memory[uart_n] != nullptr) &&
+         (rx_ring[uart_n].size() == ring_size) )
+    {   return true;   }
+
+    rx_memory_free(uart_n);
+
+    uint8_t* memory = nullptr;
+    while (memory == nullptr)
+    {
+        memory = mem_alloc((size_t)(ring_size) + DATA_RX_BUFFER_SIZE);
+        if (memory != nullptr)
+        {   break;   }
+        if (ring_size <= ns_const::MIN_UART_RX_BUFFER_SIZE)
+        {   return false;   }
+        ring_size = ring_size >> 1U;
+    }
+
+    rx_memory[uart_n] = memory;
+    rx_ring[uart_n].set_storage(memory, ring_size);
+    rx_marks[uart_n].reset();
+    framer[uart_n].set_buffer(&(memory[ring_size]), DATA_RX_BUFFER_SIZE);
+
+    return true;
+}
+
+/**
+ * @details This function detaches the Rx memory of the Port from its ring
+ * buffer and framer and releases it, and releases the templates table (the
+ * template encoding stays configured, for the next enable). The capture of
+ * the Port must be stopped.
+ */
+void InterfaceUART::rx_memory_free(const uint8_t uart_n)
+{
+    if (rx_templates[uart_n].is_enabled())
+    {   rx_templates[uart_n].configure(false);   }
+
+    // Do nothing if there is no memory
+    if (rx_memory[uart_n] == nullptr)
+    {   return;   }
+
+    rx_ring[uart_n].set_storage(nullptr, 0U);
+    rx_marks[uart_n].reset();
+    framer[uart_n].set_buffer(nullptr, 0U);
+    heap_caps_free(rx_memory[uart_n]);
+    rx_memory[uart_n] = nullptr;
+}
+
+/**
+ * @details This function allocates the Port Tx queue memory with the
+ * configured size. The memory is kept if it already has it.
+ */
+bool InterfaceUART::tx_memory_alloc(const uint8_t uart_n)
+{
+    uint32_t queue_size = ns_device::ns_uart::uart_cfg[uart_n].tx_buffer_size;
+
+    // Do nothing if the current memory has the required size
+    if ( (tx_ring_memory[uart_n] != nullptr) &&
+         (tx_ring[uart_n].size() == queue_size) )
+    {   return true;   }
+
+    tx_ring[uart_n].set_storage(nullptr, 0U);
+    mem_update(&(tx_ring_memory[uart_n]), 0U, false);
+    tx_ring_memory[uart_n] = mem_alloc(queue_size);
+    if (tx_ring_memory[uart_n] == nullptr)
+    {   return false;   }
+    tx_ring[uart_n].set_storage(tx_ring_memory[uart_n], queue_size);
+
+    return true;
+}
+
+/**
+ * @details This function allocates the buffers that the features configured
+ * for the Port use, and releases the buffers of the features that are off
+ * (their pending data was already published by the setters that turned them
+ * off). The buffers that are already allocated are kept. A feature whose
+ * buffer can't be allocated is bypassed (its frames are published as is).
+ */
+bool InterfaceUART::port_memory_alloc(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    s_uart_config* cfg = &(uart_cfg[uart_n]);
+    bool is_stamped = (cfg->timestamps != t_uart_timestamps::OFF);
+    bool allocated = true;
+
+    if (mem_update(&(tx_echo_data[uart_n]), MAX_TX_ECHO_SIZE,
+            (cfg->tx_echo != t_uart_tx_echo::OFF)) == false)
+    {   allocated = false;   }
+    if (mem_update(&(tpl_data[uart_n]), TPL_DATA_SIZE, cfg->templates) ==
+            false)
+    {   allocated = false;   }
+    if (mem_update(&(cmp_data[uart_n]), CMP_DATA_SIZE, cfg->compress) ==
+            false)
+    {   allocated = false;   }
+    if (mem_update(&(frame_deltas[uart_n]), 2U * DATA_RX_BUFFER_SIZE,
+            (cfg->timestamps == t_uart_timestamps::DELTAS)) == false)
+    {   allocated = false;   }
+    if (mem_update(&(pair_data[uart_n]), PAIR_QUEUE_SIZE,
+            (cfg->pair_port != 0U)) == false)
+    {   allocated = false;   }
+    if (mem_update(&(batch_data[uart_n]), MAX_BATCH_SIZE,
+            ( (cfg->batch_size > 0U) || is_stamped )) == false)
+    {   allocated = false;   }
+
+    // Clear the pending data of the released buffers
+    if (tx_echo_data[uart_n] == nullptr)
+    {   tx_echo_len[uart_n] = 0U;   }
+    if (frame_deltas[uart_n] == nullptr)
+    {   num_frame_deltas[uart_n] = 0U;   }
+    if (pair_data[uart_n] == nullptr)
+    {
+        pair_head[uart_n] = 0U;
+        pair_tail[uart_n] = 0U;
+    }
+    if (batch_data[uart_n] == nullptr)
+    {   batch_len[uart_n] = 0U;   }
+
+    return allocated;
+}
+
+/**
+ * @details This function releases the Rx memory, the Tx queue memory and all
+ * the features buffers of the Port, discarding their pending data.
+ */
+void InterfaceUART::port_memory_free(const uint8_t uart_n)
+{
+    rx_memory_free(uart_n);
+    tx_ring[uart_n].set_storage(nullptr, 0U);
+
+    uint8_t** memory[] =
+    {
+        &(tx_ring_memory[uart_n]), &(tx_echo_data[uart_n]),
+        &(tpl_data[uart_n]), &(cmp_data[uart_n]), &(frame_deltas[uart_n]),
+        &(pair_data[uart_n]), &(batch_data[uart_n])
+    };
+    for (uint8_t i = 0U; i < (sizeof(memory) / sizeof(memory[0])); i++)
+    {   mem_update(memory[i], 0U, false);   }
+
+    tx_echo_len[uart_n] = 0U;
+    num_frame_deltas[uart_n] = 0U;
+    pair_head[uart_n] = 0U;
+    pair_tail[uart_n] = 0U;
+    batch_len[uart_n] = 0U;
+}
+
+/**
+ * @details This function allocates a memory block from PSRAM on boards that
+ * have it (so the Ports memory doesn't use the internal RAM), or from the
+ * internal RAM otherwise.
+ */
+uint8_t* InterfaceUART::mem_alloc(const size_t size)
+{
+    #if defined(BOARD_HAS_PSRAM)
+        return (uint8_t*)(heap_caps_malloc(size, MALLOC_CAP_SPIRAM));
+    #else
+        return (uint8_t*)(heap_caps_malloc(size, MALLOC_CAP_8BIT));
+    #endif
+}
+
+/**
+ * @details This function allocates the buffer if it is needed and it is not
+ * allocated yet (an allocated buffer is kept as is), or releases it if it is
+ * not needed.
+ */
+bool InterfaceUART::mem_update(uint8_t** memory, const size_t size,
+        const bool needed)
+{
+    if (needed == false)
+    {
+        heap_caps_free(*memory);
+        *memory = nullptr;
+        return true;
+    }
+
+    if (*memory == nullptr)
+    {   *memory = mem_alloc(size);   }
+
+    return (*memory != nullptr);
+}
+
+/**
+ * @details This function stops the capture engine of the UART Port: the
+ * Event-Driven engine capture task and UART Driver if it is running, or the
+ * Poll engine Arduino Serial Port.
+ */
+void InterfaceUART::capture_stop(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    if (Capture.is_running(uart_n))
+    {   Capture.stop(uart_n);   }
+    else if ( (uart_cfg[uart_n].engine == t_uart_engine::POLL) &&
+              (SerialPort[uart_n] != nullptr) )
+    {
+        SerialPort[uart_n]->end();
+        SerialPort[uart_n]->onReceiveError(nullptr);
+    }
+}
+
+/**
+ * @details This function restarts the capture of the UART Port if it is
+ * enabled, so a new configuration is applied to the hardware. If the restart
+ * fails, the Port is left disabled.
+ */
+bool InterfaceUART::capture_restart(const uint8_t uart_n)
+{
+    using namespace ns_device::ns_uart;
+
+    // Nothing to apply if the Port is not enabled (applied on enable)
+    if (uart_cfg[uart_n].enable == false)
+    {   return true;   }
+
+    if (capture_start(uart_n) == false)
+    {
+        uart_cfg[uart_n].enable = false;
+        port_memory_free(uart_n);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @details This function sets the flight recorder trigger fired flag of the
+ * UART Port (it runs in interrupt context, so the trigger itself is fired
+ * from process()).
+ */
+void IRAM_ATTR InterfaceUART::rec_gpio_isr(void* arg)
+{
+    *((volatile bool*)(arg)) = true;
+}
+
+/**
+ * @details This function copies the arguments to the output buffer separated
+ * by a single space.
+ */
+bool InterfaceUART::args_join(int argc, char* argv[], const int first,
+        char* out, const size_t size)
+{
+    // Do nothing if there are no arguments to join
+    if ( (first >= argc) || (size == 0U) )
+    {   return false;   }
+
+    size_t out_len = 0U;
+    for (int i = first; i < argc; i++)
+    {
+        size_t word_len = strlen(argv[i]);
+        size_t sep_len = (i > first) ? 1U : 0U;
+        if (out_len + sep_len + word_len >= size)
+        {   return false;   }
+        if (sep_len > 0U)
+        {   out[out_len] = ' ';   }
+        memcpy(&(out[out_len + sep_len]), argv[i], word_len);
+        out_len = out_len + sep_len + word_len;
+    }
+    out[out_len] = '\0';
+
+    return true;
+}
+
+/**
+ * @details This function prepare a JSON string with the current
+ * "msg_status_port_n" UART Port status information and send it.
+ * It also update the "msg_status_port_n" variable to send next UART Port
+ * information the next time this function is call.
+ *
+ * UART Status Information JSON Message Format:
  * {
  *     "port":   N, // UART Port Number Status Information
  *     "enable": N, // UART Port logging disabled/enabled (0/1)
  *     "bauds":  N, // Configured Baud Rate
+ *     "engine": N, // Capture engine (0: poll, 1: event)
+ *     "burst":  N, // Max bytes drained in a single pass since last status
+ *     "ovf":    N, // Number of UART Driver overflows (event engine)
+ *     "rxbuf":  N, // Rx ring buffer size (0: not allocated, Port disabled)
+ *     "hwm":    N, // Rx ring buffer High Water Mark
+ *     "drop":   N, // Number of bytes dropped due to Rx ring buffer full
+ *     "framing": N, // Rx data framing mode (0: line, 1: idle, 2: fixed,
+ *                   // 3: cobs, 4: slip)
+ *     "ferr":   N, // Number of discarded malformed/oversized frames
+ *     "batch":  N, // Rx frames batch maximum size (0: disabled)
+ *     "ts":     N, // Rx frames timestamps (0: off, 1: on, 2: deltas)
+ *     "fmt":    S, // Character format (i.e. "8N1")
+ *     "flow":   N, // Flow control (0: none, 1: rts, 2: cts, 3: rtscts)
+ *     "hs":     N, // High-speed capture profile (0/1)
+ *     "txq":    N, // Number of bytes pending in the Tx queue
+ *     "txrej":  N, // Number of Tx messages rejected (Tx queue full)
+ *     "pair":   N, // Paired Port number (0: not paired)
+ *     "bridge": N, // Bridged Port number (0: not bridged)
+ *     "fwdrop": N, // Number of bridged bytes dropped (Tx queue full)
+ *     "tcp":    N, // TCP serial server port (0: disabled)
+ *     "tcpcli": N, // TCP serial server client connected (0/1)
+ *     "tcpdrop": N, // Number of bytes not streamed (TCP send buffer full)
+ *     "lev":    [N, N, N, N, N], // Line events counters (parity errors,
+ *                   // frame errors, BREAKs, FIFO overflows, Driver Rx
+ *                   // buffer full)
+ *     "seq":    N, // Sequence number of the next Rx message
+ *     "rxoff":  N, // Rx stream offset (bytes published or dropped)
+ *     "pubfail": N, // Number of Rx messages dropped (publish fail)
+ *     "flt":    N, // Number of Rx frames filter patterns
+ *     "fmatch": N, // Number of Rx frames that matched any filter pattern
+ *     "fdrop":  N, // Number of Rx frames dropped by the filter
+ *     "rec":    N, // Flight recorder state (0: off, 1: recording,
+ *                  // 2: post-trigger, 3: dumping)
+ *     "recsz":  N, // Flight recorder history size (bytes)
+ *     "dumps":  N, // Number of flight recorder dumps
+ *     "recmiss": N, // Number of bytes not recorded while dumping
+ *     "dedup":  N, // Repeated Rx frames collapsing window (ms, 0: off)
+ *     "rep":    N, // Number of repeated Rx frames suppressed
+ *     "tpl":    N, // Number of Rx log lines templates (-1: disabled)
+ *     "tplenc": N, // Number of Rx log lines encoded with a template
+ *     "tplraw": N, // Number of Rx log lines encoded as is
+ *     "cmp":    S, // Rx messages compression ("off" or "lzss:W:L", with
+ *                  // the window and length bits of the LZSS stream)
+ *     "cmpin":  N, // Number of bytes compressed
+ *     "cmpout": N, // Number of compressed bytes
+ *     "abd":    N, // Automatic baud rate detection state (0: idle,
+ *                  // 1: detecting, 2: detected, 3: failed)
+ *     "abdrate":N, // Last automatically detected baud rate (0: none)
+ *     "dec":    S, // Rx protocol decoder name ("off" if none)
+ *     "decrec": N, // Number of records published by the decoder
+ *     "decerr": N, // Number of frames that the decoder could not decode
+ *     "ovl":    N, // Rx overload policy (0: off, 1: drop oldest, 2: drop
+ *                  // newest, 3: summary, 4: pause)
+ *     "ovlon":  N, // Rx overloaded (0/1)
+ *     "ovltr":  N, // Number of Rx overload state transitions
+ *     "ovldrop":N, // Number of Rx bytes lost while overloaded
+ *     "caprate":N, // Capture rate of the last measure window (bytes/s)
+ *     "pubrate":N  // Publish throughput of the last measure window
+ *                  // (bytes/s, -1: not measured)
  * }
  */
 bool InterfaceUART::mqtt_send_uart_status_info()
 {
     char msg[UART_STATUS_INFO_MSG_LEN];
+    const uart_config_t* config =
+        &(ns_device::ns_uart::uart_cfg[msg_status_port_n].config);
+
+    // Character format string
+    const char* parity = "N";
+    if (config->parity == UART_PARITY_EVEN)
+    {   parity = "E";   }
+    else if (config->parity == UART_PARITY_ODD)
+    {   parity = "O";   }
+    const char* stop_bits = "1";
+    if (config->stop_bits == UART_STOP_BITS_1_5)
+    {   stop_bits = "1.5";   }
+    else if (config->stop_bits == UART_STOP_BITS_2)
+    {   stop_bits = "2";   }
+    char cmp[16] = "off";
+    if (ns_device::ns_uart::uart_cfg[msg_status_port_n].compress)
+    {
+        snprintf(cmp, sizeof(cmp), "lzss:%d:%d",
+            (int)(UARTCompressor::WINDOW_BITS),
+            (int)(UARTCompressor::LENGTH_BITS));
+    }
+    const char* dec = "off";
+    uint32_t dec_num_records = 0U;
+    uint32_t dec_num_errors = 0U;
+    UARTDecoder* port_decoder = decoder[msg_status_port_n];
+    if (port_decoder != nullptr)
+    {
+        dec = UARTDecoders::get_name(
+            ns_device::ns_uart::uart_cfg[msg_status_port_n].decoder);
+        dec_num_records = port_decoder->get_num_records();
+        dec_num_errors = port_decoder->get_num_errors();
+    }
+    int64_t pub_rate = -1;
+    uint32_t publish_rate = overload[msg_status_port_n].get_publish_rate();
+    if (publish_rate != UINT32_MAX)
+    {   pub_rate = (int64_t)(publish_rate);   }
 
     // Prepare the Message Payload
     snprintf(msg, UART_STATUS_INFO_MSG_LEN,
         "{"
             "\"port\":%" PRIu8 ","
             "\"enable\":%d,"
-            "\"bauds\":%" PRIu32
+            "\"bauds\":%" PRIu32 ","
+            "\"engine\":%d,"
+            "\"burst\":%" PRIu32 ","
+            "\"ovf\":%" PRIu32 ","
+            "\"rxbuf\":%" PRIu32 ","
+            "\"hwm\":%" PRIu32 ","
+            "\"drop\":%" PRIu32 ","
+            "\"framing\":%d,"
+            "\"ferr\":%" PRIu32 ","
+            "\"batch\":%d,"
+            "\"ts\":%d,"
+            "\"fmt\":\"%d%s%s\","
+            "\"flow\":%d,"
+            "\"hs\":%d,"
+            "\"txq\":%" PRIu32 ","
+            "\"txrej\":%" PRIu32 ","
+            "\"pair\":%d,"
+            "\"bridge\":%d,"
+            "\"fwdrop\":%" PRIu32 ","
+            "\"tcp\":%d,"
+            "\"tcpcli\":%d,"
+            "\"tcpdrop\":%" PRIu32 ","
+            "\"lev\":[%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%"
+                PRIu32 "],"
+            "\"seq\":%" PRIu32 ","
+            "\"rxoff\":%" PRIu64 ","
+            "\"pubfail\":%" PRIu32 ","
+            "\"flt\":%d,"
+            "\"fmatch\":%" PRIu32 ","
+            "\"fdrop\":%" PRIu32 ","
+            "\"rec\":%d,"
+            "\"recsz\":%" PRIu32 ","
+            "\"dumps\":%" PRIu32 ","
+            "\"recmiss\":%" PRIu32 ","
+            "\"dedup\":%" PRIu32 ","
+            "\"rep\":%" PRIu32 ","
+            "\"tpl\":%d,"
+            "\"tplenc\":%" PRIu32 ","
+            "\"tplraw\":%" PRIu32 ","
+            "\"cmp\":\"%s\","
+            "\"cmpin\":%" PRIu32 ","
+            "\"cmpout\":%" PRIu32 ","
+            "\"abd\":%d,"
+            "\"abdrate\":%" PRIu32 ","
+            "\"dec\":\"%s\","
+            "\"decrec\":%" PRIu32 ","
+            "\"decerr\":%" PRIu32 ","
+            "\"ovl\":%d,"
+            "\"ovlon\":%d,"
+            "\"ovltr\":%" PRIu32 ","
+            "\"ovldrop\":%" PRIu32 ","
+            "\"caprate\":%" PRIu32 ","
+            "\"pubrate\":%" PRId64
         "}",
         msg_status_port_n,
         (int)(ns_device::ns_uart::uart_cfg[msg_status_port_n].enable),
-        ns_device::ns_uart::uart_cfg[msg_status_port_n].bauds
+        ns_device::ns_uart::uart_cfg[msg_status_port_n].bauds,
+        (int)(ns_device::ns_uart::uart_cfg[msg_status_port_n].engine),
+        rx_burst_max[msg_status_port_n],
+        Capture.get_num_fifo_ovf(msg_status_port_n) +
+            Capture.get_num_buffer_full(msg_status_port_n),
+        rx_ring[msg_status_port_n].size(),
+        rx_ring[msg_status_port_n].get_high_water_mark(),
+        rx_ring[msg_status_port_n].get_num_dropped(),
+        (int)(ns_device::ns_uart::uart_cfg[msg_status_port_n].framing),
+        framer[msg_status_port_n].get_num_errors(),
+        (int)(ns_device::ns_uart::uart_cfg[msg_status_port_n].batch_size),
+        (int)(ns_device::ns_uart::uart_cfg[msg_status_port_n].timestamps),
+        5 + (int)(config->data_bits), parity, stop_bits,
+        (int)(config->flow_ctrl),
+        (int)(ns_device::ns_uart::uart_cfg[msg_status_port_n].high_speed),
+        tx_ring[msg_status_port_n].available(),
+        tx_num_rejected[msg_status_port_n],
+        (int)(ns_device::ns_uart::uart_cfg[msg_status_port_n].pair_port),
+        (int)(ns_device::ns_uart::uart_cfg[msg_status_port_n].bridge_port),
+        tx_ring[msg_status_port_n].get_num_dropped(),
+        (int)(ns_device::ns_uart::uart_cfg[msg_status_port_n].tcp_port),
+        (int)(tcp_server[msg_status_port_n].is_connected()),
+        tcp_server[msg_status_port_n].get_num_dropped(),
+        rx_events[msg_status_port_n].get_count(
+            UARTLineEvents::t_event::PARITY_ERR),
+        rx_events[msg_status_port_n].get_count(
+            UARTLineEvents::t_event::FRAME_ERR),
+        rx_events[msg_status_port_n].get_count(
+            UARTLineEvents::t_event::BREAK),
+        rx_events[msg_status_port_n].get_count(
+            UARTLineEvents::t_event::FIFO_OVF),
+        rx_events[msg_status_port_n].get_count(
+            UARTLineEvents::t_event::BUFFER_FULL),
+        rx_seq_n[msg_status_port_n],
+        rx_stream_offset[msg_status_port_n],
+        rx_num_pub_fail[msg_status_port_n],
+        (int)(rx_filter[msg_status_port_n].get_num_patterns()),
+        rx_filter[msg_status_port_n].get_num_matched(),
+        rx_filter[msg_status_port_n].get_num_dropped(),
+        (int)(recorder[msg_status_port_n].get_state()),
+        recorder[msg_status_port_n].get_size(),
+        recorder[msg_status_port_n].get_num_dumps(),
+        recorder[msg_status_port_n].get_num_missed(),
+        ns_device::ns_uart::uart_cfg[msg_status_port_n].dedup_ms,
+        dedup_num_suppressed[msg_status_port_n],
+        (rx_templates[msg_status_port_n].is_enabled()) ?
+            (int)(rx_templates[msg_status_port_n].get_num_templates()) : -1,
+        rx_templates[msg_status_port_n].get_num_encoded(),
+        rx_templates[msg_status_port_n].get_num_raw(),
+        cmp,
+        compressor[msg_status_port_n].get_num_in(),
+        compressor[msg_status_port_n].get_num_out(),
+        (int)(autobaud[msg_status_port_n].get_state()),
+        autobaud[msg_status_port_n].get_rate(),
+        dec,
+        dec_num_records,
+        dec_num_errors,
+        (int)(ns_device::ns_uart::uart_cfg[msg_status_port_n].overload),
+        (int)(overload[msg_status_port_n].is_overloaded()),
+        overload[msg_status_port_n].get_num_transitions(),
+        overload[msg_status_port_n].get_num_lost(),
+        overload[msg_status_port_n].get_capture_rate(),
+        pub_rate
     );
 
+    // Restart the burst measurement for next status report of the Port
+    rx_burst_max[msg_status_port_n] = 0U;
+
     // Update UART Port Number to send info on the status message
     msg_status_port_n = msg_status_port_n + 1U;
     if (msg_status_port_n >= ns_const::MAX_NUM_UART)
@@ -422,30 +4285,185 @@ bool InterfaceUART::mqtt_send_uart_status_info()
     return MQTT.publish(topic_status, msg);
 }
 
+/**
+ * @details This function prepare a JSON string with the Rx overload state of
+ * an UART Port and send it through the UART Status topic (the "overload" key
+ * tells it apart from the UART Status information messages).
+ *
+ * UART Rx Overload Report JSON Message Format:
+ * {
+ *     "port":     N, // UART Port Number
+ *     "overload": S, // Report event ("enter": the Port became overloaded,
+ *                    // "exit": the Port recovered, "active": a measure
+ *                    // window ended while overloaded)
+ *     "policy":   N, // Rx overload policy (0: off, 1: drop oldest,
+ *                    // 2: drop newest, 3: summary, 4: pause)
+ *     "fill":     N, // Rx ring buffer fill (%)
+ *     "caprate":  N, // Capture rate of the last measure window (bytes/s)
+ *     "pubrate":  N, // Publish throughput of the last measure window
+ *                    // (bytes/s, -1: not measured)
+ *     "ovltr":    N, // Number of Rx overload state transitions
+ *     "ovldrop":  N, // Number of Rx bytes lost while overloaded (dropped
+ *                    // or summarized)
+ *     "sumframes": N, // Number of Rx frames summarized in the last window
+ *     "sumbytes": N  // Number of Rx bytes summarized in the last window
+ * }
+ */
+bool InterfaceUART::mqtt_send_uart_overload_info(const uint8_t uart_n,
+        const UARTOverload::t_event event)
+{
+    char msg[UART_OVERLOAD_INFO_MSG_LEN];
+
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    const char* event_name = "active";
+    if (event == UARTOverload::t_event::ENTER)
+    {   event_name = "enter";   }
+    else if (event == UARTOverload::t_event::EXIT)
+    {   event_name = "exit";   }
+    uint32_t fill_pct = 0U;
+    if (rx_ring[uart_n].size() > 0U)
+    {
+        fill_pct = (uint32_t)(((uint64_t)(rx_ring[uart_n].available()) *
+            100U) / rx_ring[uart_n].size());
+    }
+    int64_t pub_rate = -1;
+    if (overload[uart_n].get_publish_rate() != UINT32_MAX)
+    {   pub_rate = (int64_t)(overload[uart_n].get_publish_rate());   }
+    uint32_t sum_frames = 0U;
+    uint32_t sum_bytes = 0U;
+    overload[uart_n].get_summary(&sum_frames, &sum_bytes);
+
+    // Prepare the Message Payload
+    snprintf(msg, UART_OVERLOAD_INFO_MSG_LEN,
+        "{"
+            "\"port\":%" PRIu8 ","
+            "\"overload\":\"%s\","
+            "\"policy\":%d,"
+            "\"fill\":%" PRIu32 ","
+            "\"caprate\":%" PRIu32 ","
+            "\"pubrate\":%" PRId64 ","
+            "\"ovltr\":%" PRIu32 ","
+            "\"ovldrop\":%" PRIu32 ","
+            "\"sumframes\":%" PRIu32 ","
+            "\"sumbytes\":%" PRIu32
+        "}",
+        uart_n,
+        event_name,
+        (int)(ns_device::ns_uart::uart_cfg[uart_n].overload),
+        fill_pct,
+        overload[uart_n].get_capture_rate(),
+        pub_rate,
+        overload[uart_n].get_num_transitions(),
+        overload[uart_n].get_num_lost(),
+        sum_frames,
+        sum_bytes
+    );
+
+    // Send the Message
+    return MQTT.publish(topic_status, msg);
+}
+
 /**
  * @details Uses the MQTT component to send a received UART message through
- * the UART Rx topic.
+ * the UART Rx topic. The message is published with its length, so binary
+ * data (including 0x00 bytes) is sent byte-exact. Each message takes the next
+ * sequence number and advances the Rx stream offset by its length, even if
+ * the publish fails (so consumers see the gap). With the sequence header
+ * enabled, the message is prefixed with both (sequence number 4 bytes, then
+ * offset of its first byte 8 bytes, little endian). With compression
+ * enabled, the message (but not the sequence header) is replaced by its
+ * compressed form, and the compression window is emptied if the publish
+ * fails (the next message must be decodable without the lost one).
+ */
+bool InterfaceUART::mqtt_publish_rx(const uint8_t uart_n, const uint8_t* msg,
+        const size_t len)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    uint32_t seq_n = rx_seq_n[uart_n];
+    uint64_t offset = rx_stream_offset[uart_n];
+    rx_seq_n[uart_n] = seq_n + 1U;
+    rx_stream_offset[uart_n] = offset + (uint64_t)(len);
+
+    // Compress the message
+    const uint8_t* data = msg;
+    size_t data_len = len;
+    if (ns_device::ns_uart::uart_cfg[uart_n].compress)
+    {
+        data = cmp_data[uart_n];
+        data_len = 0U;
+        if (cmp_data[uart_n] != nullptr)
+        {
+            data_len = (size_t)(compressor[uart_n].compress(msg,
+                (uint32_t)(len), cmp_data[uart_n], CMP_DATA_SIZE));
+        }
+        if (data_len == 0U)
+        {
+            rx_num_pub_fail[uart_n] = rx_num_pub_fail[uart_n] + 1U;
+            return false;
+        }
+    }
+
+    bool publish_ok = false;
+    if (ns_device::ns_uart::uart_cfg[uart_n].rx_seq)
+    {
+        uint8_t header[RX_SEQ_HEADER_SIZE];
+        for (uint8_t i = 0U; i < 4U; i++)
+        {   header[i] = (uint8_t)((seq_n >> (8U * i)) & 0xFFU);   }
+        for (uint8_t i = 0U; i < 8U; i++)
+        {   header[4U + i] = (uint8_t)((offset >> (8U * i)) & 0xFFU);   }
+        publish_ok = MQTT.publish(topic_rx[uart_n], header,
+            RX_SEQ_HEADER_SIZE, data, data_len);
+    }
+    else
+    {   publish_ok = MQTT.publish(topic_rx[uart_n], data, data_len);   }
+
+    if (publish_ok == false)
+    {
+        rx_num_pub_fail[uart_n] = rx_num_pub_fail[uart_n] + 1U;
+        compressor[uart_n].reset();
+    }
+
+    return publish_ok;
+}
+
+/**
+ * @details Uses the MQTT component to send the echo of transmitted UART
+ * messages through the UART Tx echo topic (binary safe).
  */
-bool InterfaceUART::mqtt_publish_rx(const uint8_t uart_n, const char* msg)
+bool InterfaceUART::mqtt_publish_tx(const uint8_t uart_n, const uint8_t* msg,
+        const size_t len)
 {
     // Do nothing if specified UART Port number is invalid
     if (uart_n >= ns_const::MAX_NUM_UART)
     {   return false;   }
 
-    return MQTT.publish(topic_rx[uart_n], msg);
+    return MQTT.publish(topic_tx_echo[uart_n], msg, len);
 }
 
 /**
- * @details Uses the MQTT component to send a transmitted UART message through
- * the UART Tx topic.
+ * @details Uses the MQTT component to send a Tx message rejection through the
+ * UART Configuration topic, with the rejected message length and the free
+ * space of the Port Tx queue:
+ * "nack tx <message length> <free bytes>"
  */
-bool InterfaceUART::mqtt_publish_tx(const uint8_t uart_n, const char* msg)
+bool InterfaceUART::mqtt_send_tx_nack(const uint8_t uart_n, const size_t len)
 {
+    char msg[48];
+
     // Do nothing if specified UART Port number is invalid
     if (uart_n >= ns_const::MAX_NUM_UART)
     {   return false;   }
 
-    return MQTT.publish(topic_tx[uart_n], msg);
+    snprintf(msg, sizeof(msg), "nack tx %" PRIu32 " %" PRIu32,
+        (uint32_t)(len), tx_ring[uart_n].free_space());
+
+    return MQTT.publish(topic_cfg[uart_n], msg);
 }
 
 /*****************************************************************************/
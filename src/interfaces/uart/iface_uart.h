@@ -54,6 +54,48 @@
 // Constant Data
 #include "constants.h"
 
+// Global Data
+#include "../../global/global.h"
+
+// UART Event-Driven Capture Engine
+#include "uart_capture.h"
+
+// UART Lock-Free Ring Buffer
+#include "uart_ring_buffer.h"
+
+// UART Rx Data Stream Framer
+#include "uart_framer.h"
+
+// UART Rx Data Arrival Timestamps
+#include "uart_timestamps.h"
+
+// UART Line Events Queue
+#include "uart_line_events.h"
+
+// UART Rx Frames Filter
+#include "uart_filter.h"
+
+// UART Flight Recorder
+#include "uart_recorder.h"
+
+// UART Rx Log Lines Template Miner
+#include "uart_templates.h"
+
+// UART Rx Stream Compressor
+#include "uart_compressor.h"
+
+// UART Automatic Baud Rate Detection
+#include "uart_autobaud.h"
+
+// UART Rx Overload Detector
+#include "uart_overload.h"
+
+// UART Protocol Decoders Registry
+#include "uart_decoders.h"
+
+// UART Raw TCP Serial Server
+#include "uart_tcp_server.h"
+
 /*****************************************************************************/
 
 /* Class Interface */
@@ -81,7 +123,7 @@ class InterfaceUART
          * @brief Maximum length for UART Status Information message
          * that will be send through as MQTT payload.
          */
-        static constexpr uint16_t UART_STATUS_INFO_MSG_LEN = 50U;
+        static constexpr uint16_t UART_STATUS_INFO_MSG_LEN = 1152U;
 
         /**
          * @brief MQTT Topic to send UARTs status information.
@@ -104,12 +146,237 @@ class InterfaceUART
          */
         static constexpr char MQTT_TOPIC_TX[] = "/%s/uart/%d/tx";
 
+        /**
+         * @brief MQTT Topic to publish the echo of the UART Tx messages
+         * (a different topic than the Tx one, so the device doesn't receive
+         * its own echoes as new messages to transmit).
+         */
+        static constexpr char MQTT_TOPIC_TX_ECHO[] = "/%s/uart/%d/tx/echo";
+
+        /**
+         * @brief MQTT Topic to publish the UART flight recorder dumps.
+         */
+        static constexpr char MQTT_TOPIC_REC[] = "/%s/uart/%d/rec";
+
+        /**
+         * @brief MQTT Topic to publish the UART Rx log lines templates
+         * (retained).
+         */
+        static constexpr char MQTT_TOPIC_TEMPLATES[] = "/%s/uart/%d/templates";
+
+        /**
+         * @brief MQTT Topic prefix to publish the UART protocol decoder
+         * records (followed by the decoder name and its subtopics).
+         */
+        static constexpr char MQTT_TOPIC_DECODER[] = "/%s/uart/%d/";
+
+        /**
+         * @brief Maximum size of a flight recorder dump chunk (streamed to
+         * the MQTT Client, so it is not limited by its buffer size).
+         */
+        static constexpr uint32_t REC_CHUNK_SIZE = 4096U;
+
+        /**
+         * @brief Size of the header of a flight recorder dump chunk (dump
+         * number + chunk offset + dump length + trigger position).
+         */
+        static constexpr uint32_t REC_CHUNK_HEADER_SIZE = 14U;
+
+        /**
+         * @brief Maximum size of a Tx echo message (the MQTT Client buffer
+         * minus the MQTT header and topic).
+         */
+        static constexpr uint32_t MAX_TX_ECHO_SIZE =
+            ns_const::MQTT_BUFFER_SIZE - MQTT_TOPIC_MAX_LEN - 8U;
+
+        /**
+         * @brief Maximum latency of a batch of Tx echoes (ms).
+         */
+        static constexpr uint32_t T_TX_ECHO_BATCH_MS = 100U;
+
+        /**
+         * @brief Time to wait before retrying to start a TCP serial server
+         * that failed to start (ms).
+         */
+        static constexpr uint32_t T_TCP_RETRY_MS = 5000U;
+
         /**
          * @brief Maximum number of bytes that can be buffered from each
          * UART Port received data.
          */
         static constexpr uint32_t DATA_RX_BUFFER_SIZE = (256U + 1U);
 
+        /**
+         * @brief Maximum inter-byte silence for IDLE framing (number of
+         * character times, limited by UART hardware Rx timeout).
+         */
+        static constexpr uint8_t MAX_FRAME_IDLE_CHARS = 126U;
+
+        /**
+         * @brief UART hardware Rx timeout to restore when IDLE framing is
+         * not used (number of character times).
+         */
+        static constexpr uint8_t DEFAULT_RX_TIMEOUT_CHARS = 10U;
+
+        /**
+         * @brief Minimum size of the UART Driver Rx buffer of each UART Port
+         * (the driver requires it to be bigger than the hardware FIFO).
+         */
+        static constexpr uint32_t MIN_DRIVER_RX_BUFFER_SIZE = 1024U;
+
+        /**
+         * @brief Maximum size of the UART Driver Rx buffer of each UART Port
+         * (allocated by the driver from internal RAM, about 30ms of data at
+         * 5 Mbaud).
+         */
+        static constexpr uint32_t MAX_DRIVER_RX_BUFFER_SIZE = 16384U;
+
+        /**
+         * @brief UART Rx FIFO full interrupt threshold (bytes of the 128
+         * bytes hardware FIFO).
+         */
+        static constexpr uint8_t RX_FIFO_FULL_THRESH = 112U;
+
+        /**
+         * @brief UART Rx FIFO full interrupt threshold with the high-speed
+         * profile (leaves room for 64 characters of interrupt latency,
+         * 128us at 5 Mbaud).
+         */
+        static constexpr uint8_t HS_RX_FIFO_FULL_THRESH = 64U;
+
+        /**
+         * @brief UART Rx FIFO full interrupt threshold of bridged Ports
+         * (each received character is forwarded as soon as it arrives).
+         */
+        static constexpr uint8_t BRIDGE_RX_FIFO_FULL_THRESH = 1U;
+
+        /**
+         * @brief UART hardware Rx timeout of bridged Ports (number of
+         * character times).
+         */
+        static constexpr uint8_t BRIDGE_RX_TIMEOUT_CHARS = 1U;
+
+        /**
+         * @brief Arduino Serial configuration base value (to build the
+         * SERIAL_8N1 like values from the UART Driver line parameters).
+         */
+        static constexpr uint32_t SERIAL_CONFIG_BASE = 0x8000000U;
+
+        /**
+         * @brief Maximum size of a batch of Rx frames (the MQTT Client
+         * buffer minus the MQTT header and topic).
+         */
+        static constexpr uint32_t MAX_BATCH_SIZE =
+            ns_const::MQTT_BUFFER_SIZE - MQTT_TOPIC_MAX_LEN - 8U;
+
+        /**
+         * @brief Minimum size of a batch of Rx frames.
+         */
+        static constexpr uint32_t MIN_BATCH_SIZE = 64U;
+
+        /**
+         * @brief Size of a template encoded Rx log line buffer (one more
+         * byte than a frame, for lines encoded as is).
+         */
+        static constexpr uint32_t TPL_DATA_SIZE = DATA_RX_BUFFER_SIZE + 1U;
+
+        /**
+         * @brief Size of a compressed Rx message buffer.
+         */
+        static constexpr uint32_t CMP_DATA_SIZE =
+            MAX_BATCH_SIZE + UARTCompressor::HEADER_SIZE;
+
+        /**
+         * @brief Size of the length field that precedes each frame in a
+         * batch of binary framing mode frames.
+         */
+        static constexpr uint32_t BATCH_FRAME_LEN_SIZE = 2U;
+
+        /**
+         * @brief Default maximum latency of a batch of Rx frames (ms).
+         */
+        static constexpr uint16_t DEFAULT_BATCH_MS = 100U;
+
+        /**
+         * @brief Size of the header of a timestamped Rx frame record
+         * (flags + first byte timestamp + frame length).
+         */
+        static constexpr uint32_t RX_RECORD_HEADER_SIZE = 11U;
+
+        /**
+         * @brief Size of the sequence header of the Rx messages (sequence
+         * number + stream offset).
+         */
+        static constexpr uint32_t RX_SEQ_HEADER_SIZE = 12U;
+
+        /**
+         * @brief Timestamped Rx frame record flag: The frame data is
+         * followed by the per-byte inter-arrival deltas.
+         */
+        static constexpr uint8_t RX_RECORD_FLAG_DELTAS = 0x01U;
+
+        /**
+         * @brief Timestamped Rx frame record flag: The frame was received
+         * by the secondary (higher number) Port of a pair (direction B->A).
+         */
+        static constexpr uint8_t RX_RECORD_FLAG_DIR = 0x02U;
+
+        /**
+         * @brief Timestamped Rx frame record flag: The record is a line
+         * event (its data is the event type) instead of a frame.
+         */
+        static constexpr uint8_t RX_RECORD_FLAG_EVENT = 0x04U;
+
+        /**
+         * @brief Timestamped Rx frame record flag: The record summarizes
+         * repeated frames (its data is the number of repetitions and the
+         * time of the last one).
+         */
+        static constexpr uint8_t RX_RECORD_FLAG_REPEAT = 0x08U;
+
+        /**
+         * @brief Timestamped Rx frame record flag: The record data is a log
+         * line encoded with its template.
+         */
+        static constexpr uint8_t RX_RECORD_FLAG_TEMPLATE = 0x10U;
+
+        /**
+         * @brief Maximum repeated frames collapsing window (ms).
+         */
+        static constexpr uint32_t MAX_DEDUP_MS = 3600000U;
+
+        /**
+         * @brief Maximum length of a repeated frames summary.
+         */
+        static constexpr uint32_t DEDUP_SUMMARY_LEN = 80U;
+
+        /**
+         * @brief Size of the queue of each paired Port where timestamped
+         * frame records wait to be merged in order.
+         */
+        static constexpr uint32_t PAIR_QUEUE_SIZE = 2048U;
+
+        /**
+         * @brief Default pair mode frames reorder window (ms).
+         */
+        static constexpr uint16_t DEFAULT_PAIR_WINDOW_MS = 20U;
+
+        /**
+         * @brief Maximum pair mode frames reorder window (ms).
+         */
+        static constexpr uint16_t MAX_PAIR_WINDOW_MS = 1000U;
+
+        /**
+         * @brief Maximum length for UART Rx overload report message.
+         */
+        static constexpr uint16_t UART_OVERLOAD_INFO_MSG_LEN = 256U;
+
+        /**
+         * @brief Size of the chunks read to discard Poll engine Serial Port
+         * data when it can't be stored.
+         */
+        static constexpr uint32_t POLL_DISCARD_CHUNK_SIZE = 64U;
+
     /******************************************************************/
 
     /* Public Constants */
@@ -187,129 +454,1227 @@ class InterfaceUART
         bool uart_config_speed(const uint8_t uart_n, const uint32_t bauds);
 
         /**
-         * @brief Enable or disable an UART Port to start being
-         * monitorized and logged.
-         * @param uart_n UART Port number to enable.
-         * @param enable Enable/Disable the UART Port.
-         * @return true Enable/Disable success.
-         * @return false Enable/Disable fail.
+         * @brief Start the automatic baud rate detection of an enabled UART
+         * Port: the Rx frames are dropped until the line speed is detected,
+         * and then the Port is configured with it.
+         * @param uart_n UART Port number to configure.
+         * @param timeout_ms Detection timeout (ms, 0: stop the detection).
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        bool uart_enable(const uint8_t uart_n, const bool enable);
+        bool uart_config_autobaud(const uint8_t uart_n,
+                const uint32_t timeout_ms);
 
         /**
-         * @brief Transmit a message through the specified UART Port.
-         * The UART Port must be already configured-enabled.
-         * @param uart_n UART Port number to Transmit the message.
-         * @param msg Message data to be transmitted.
-         * @return true Transmission success.
-         * @return false Transmission fail.
+         * @brief Configure the character format of an UART Port.
+         * @param uart_n UART Port number to configure.
+         * @param data_bits Number of data bits.
+         * @param parity Parity mode.
+         * @param stop_bits Number of stop bits.
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        bool uart_tx_msg(const uint8_t uart_n, const char* msg);
+        bool uart_config_format(const uint8_t uart_n,
+                const uart_word_length_t data_bits,
+                const uart_parity_t parity,
+                const uart_stop_bits_t stop_bits);
 
         /**
-         * @brief Transmit multiple messages through the specified UART
-         * Port.
-         * The UART Port must be already configured-enabled.
-         * @param uart_n UART Port number to Transmit the messages.
-         * @param argc Number of messages to be transmitted.
-         * @param argv List of messages to be transmitted.
-         * @return true Transmission success.
-         * @return false Transmission fail.
+         * @brief Configure the Rx and Tx GPIOs of an UART Port.
+         * @param uart_n UART Port number to configure.
+         * @param rx_pin Rx GPIO (-1 for Port default).
+         * @param tx_pin Tx GPIO (-1 for Port default).
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        bool uart_tx_msg(const uint8_t uart_n, int argc, char* argv[]);
-
-    /******************************************************************/
-
-    /* Private Methods */
-
-    private:
+        bool uart_config_pins(const uint8_t uart_n, const int8_t rx_pin,
+                const int8_t tx_pin);
 
         /**
-         * @brief Handle reception of UART messages from the specified
-         * UART Port (forward received messages from UART to MQTT).
-         * @param uart_n UART Port number to handle.
-         * @return true Handle successs.
-         * @return false Handle fail.
+         * @brief Configure the hardware flow control of an UART Port.
+         * @param uart_n UART Port number to configure.
+         * @param flow_ctrl Flow control mode.
+         * @param rts_pin RTS GPIO (-1 for none).
+         * @param cts_pin CTS GPIO (-1 for none).
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        bool handle_uart_rx(const uint8_t uart_n);
+        bool uart_config_flow(const uint8_t uart_n,
+                const uart_hw_flowcontrol_t flow_ctrl, const int8_t rts_pin,
+                const int8_t cts_pin);
 
         /**
-         * @brief Publish the UART Status informationan MQTT message.
-         * @return true Publish success.
-         * @return false Publish fail.
+         * @brief Select the capture profile of an UART Port.
+         * @param uart_n UART Port number to configure.
+         * @param high_speed Use the high-speed profile (2 to 5 Mbaud).
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        bool mqtt_send_uart_status_info();
+        bool uart_config_profile(const uint8_t uart_n, const bool high_speed);
 
         /**
-         * @brief Send an UART Rx message to the component MQTT.
-         * @param uart_n UART Port number to publish on it MQTT Topic.
-         * @param msg Message payload data to send.
-         * @return true Publish success.
-         * @return false Publish fail.
+         * @brief Configure how the Rx data stream of an UART Port is split
+         * into messages.
+         * @param uart_n UART Port number to configure.
+         * @param framing Framing mode.
+         * @param param Framing mode parameter (LINE: delimiter character,
+         * IDLE: inter-byte silence character times, FIXED: frame length),
+         * 0 to use the mode default value.
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        bool mqtt_publish_rx(const uint8_t uart_n, const char* msg);
+        bool uart_config_framing(const uint8_t uart_n,
+                const ns_device::ns_uart::t_uart_framing framing,
+                uint32_t param);
 
         /**
-         * @brief Send an UART Tx message to the component MQTT.
-         * @param uart_n UART Port number to publish on it MQTT Topic.
-         * @param msg Message payload data to send.
-         * @return true Publish success.
-         * @return false Publish fail.
+         * @brief Configure the batching of Rx frames of an UART Port into
+         * single MQTT messages (any pending batch is published first).
+         * @param uart_n UART Port number to configure.
+         * @param size Maximum size of a batch message (0 to disable).
+         * @param ms Maximum time a frame can wait in a batch.
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        bool mqtt_publish_tx(const uint8_t uart_n, const char* msg);
-
-    /******************************************************************/
+        bool uart_config_batch(const uint8_t uart_n, const uint32_t size,
+                const uint32_t ms);
 
-    /* Public Attributes */
+        /**
+         * @brief Configure the size of the Rx ring buffer of an UART Port
+         * (the capture is restarted if the Port is already enabled).
+         * @param uart_n UART Port number to configure.
+         * @param size Rx ring buffer size (rounded up to a power of two).
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_rx_buffer(const uint8_t uart_n, uint32_t size);
 
-    public:
+        /**
+         * @brief Configure the size of the Rx ring buffer of an UART Port
+         * to be derived from its speed: the data received during a publish
+         * stall (the capture is restarted if the Port is already enabled).
+         * @param uart_n UART Port number to configure.
+         * @param stall_ms Publish stall time that the buffer must hold.
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_rx_buffer_auto(const uint8_t uart_n,
+                const uint32_t stall_ms);
 
-    /******************************************************************/
+        /**
+         * @brief Configure the size of the Tx queue of an UART Port (the
+         * capture is restarted if the Port is already enabled, discarding
+         * any pending Tx data).
+         * @param uart_n UART Port number to configure.
+         * @param size Tx queue size (rounded up to a power of two).
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_tx_buffer(const uint8_t uart_n, uint32_t size);
 
-    /* Private Attributes */
+        /**
+         * @brief Configure the echo of the Tx messages of an UART Port
+         * (any pending echo is published first).
+         * @param uart_n UART Port number to configure.
+         * @param mode Tx echo mode.
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_tx_echo(const uint8_t uart_n,
+                const ns_device::ns_uart::t_uart_tx_echo mode);
 
-    private:
+        /**
+         * @brief Configure the in-band publication of the line events
+         * (parity/frame errors, BREAK conditions, FIFO overflows and Driver
+         * buffer full) of an UART Port as timestamped records. Timestamps
+         * are enabled if they were off.
+         * @param uart_n UART Port number to configure.
+         * @param enable Publish (true) or only count (false) the events.
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_line_events(const uint8_t uart_n, const bool enable);
 
         /**
-         * @brief Component initialized status (init() method was call).
+         * @brief Configure the sequence header of the Rx messages of an UART
+         * Port (message sequence number and Rx stream byte offset, to detect
+         * lost messages).
+         * @param uart_n UART Port number to configure.
+         * @param enable Prefix (true) or not (false) the sequence header.
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        bool initialized;
+        bool uart_config_seq(const uint8_t uart_n, const bool enable);
 
         /**
-         * @brief Pointers to Serial Ports to use.
+         * @brief Configure the collapsing of repeated Rx frames of an UART
+         * Port: identical consecutive frames are suppressed and summarized
+         * in a single "repeated N times" record.
+         * @param uart_n UART Port number to configure.
+         * @param window_ms Maximum time between repetitions, and maximum
+         * delay of a summary (0 to disable).
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        HardwareSerial* SerialPort[ns_const::MAX_NUM_UART];
+        bool uart_config_dedup(const uint8_t uart_n, const uint32_t window_ms);
 
         /**
-         * @brief MQTT Topic to send UARTs status information.
-         * The device publish current UARTs configurations periodically.
+         * @brief Configure the Rx overload policy of an UART Port, applied
+         * while the uplink can't keep up with the capture (discard the
+         * oldest or the newest Rx data, publish only a summary of the
+         * frames or pause the capture).
+         * @param uart_n UART Port number to configure.
+         * @param policy Overload policy.
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        char topic_status[MQTT_TOPIC_MAX_LEN];
+        bool uart_config_overload(const uint8_t uart_n,
+                const ns_device::ns_uart::t_uart_overload policy);
 
         /**
-         * @brief MQTT Topics to configure-enable an UART Port remotely.
+         * @brief Configure the template encoding of the Rx log lines of an
+         * UART Port: the line templates are learned and published once on
+         * the templates topic, and the lines are published as their
+         * template ID and variable tokens.
+         * @param uart_n UART Port number to configure.
+         * @param enable Enable or disable the template encoding.
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        char topic_cfg[ns_const::MAX_NUM_UART][MQTT_TOPIC_MAX_LEN];
+        bool uart_config_templates(const uint8_t uart_n, const bool enable);
 
         /**
-         * @brief MQTT Topics to send UART Rx message.
+         * @brief Configure the compression of the Rx messages of an UART
+         * Port (streaming LZSS, with the compression context kept across
+         * messages).
+         * @param uart_n UART Port number to configure.
+         * @param enable Enable or disable the compression.
+         * @return true Configuration success.
+         * @return false Configuration fail.
          */
-        char topic_rx[ns_const::MAX_NUM_UART][MQTT_TOPIC_MAX_LEN];
+        bool uart_config_compress(const uint8_t uart_n, const bool enable);
 
         /**
-         * @brief MQTT Topics to send UART Tx message.
+         * @brief Configure the protocol decoder of an UART Port: the Rx
+         * frames are fed to the decoder (with the framing that it requires)
+         * and its records are published to the decoder topic instead of
+         * the raw data. Naming the active decoder only applies its options.
+         * @param uart_n UART Port number to configure.
+         * @param argc Number of arguments.
+         * @param argv Arguments: decoder name ("off" to remove it) and its
+         * options.
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_decoder(const uint8_t uart_n, int argc,
+                char* argv[]);
+
+        /**
+         * @brief Add an include or exclude pattern to the Rx frames filter
+         * of an UART Port (frames that don't pass the filter are dropped
+         * before being published).
+         * @param uart_n UART Port number to configure.
+         * @param rule Include or exclude rule.
+         * @param pattern Pattern string ("^" and "$" anchor it to the frame
+         * start and end).
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_filter_add(const uint8_t uart_n,
+                const UARTFilter::t_rule rule, const char* pattern);
+
+        /**
+         * @brief Remove all the patterns of the Rx frames filter of an UART
+         * Port (every frame is published).
+         * @param uart_n UART Port number to configure.
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_filter_clear(const uint8_t uart_n);
+
+        /**
+         * @brief Configure the timestamping of the Rx frames of an UART
+         * Port (any pending batch is published first).
+         * @param uart_n UART Port number to configure.
+         * @param mode Timestamping mode.
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_timestamps(const uint8_t uart_n,
+                const ns_device::ns_uart::t_uart_timestamps mode);
+
+        /**
+         * @brief Bind two UART Ports as the two directions of a link, so
+         * their frames are merged in a single timestamp-ordered stream
+         * published on the Rx topic of the lower number Port (any pending
+         * frames of previous pairs are published first).
+         * @param uart_n UART Port number to configure.
+         * @param pair_n UART Port number to pair with (0 to unpair).
+         * @param window_ms Frames reorder window (ms).
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_pair(const uint8_t uart_n, const uint8_t pair_n,
+                const uint32_t window_ms);
+
+        /**
+         * @brief Bridge two UART Ports, so the data received by each one is
+         * retransmitted by the other from the capture engine, while both
+         * directions are still logged. Both Ports are switched to the
+         * Event-Driven capture engine and their Tx is reserved for the
+         * bridge.
+         * @param uart_n UART Port number to configure.
+         * @param bridge_n UART Port number to bridge with (0 to remove the
+         * bridge).
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_bridge(const uint8_t uart_n, const uint8_t bridge_n);
+
+        /**
+         * @brief Configure the raw TCP serial server of an UART Port, that
+         * streams the received data without framing to a TCP client and
+         * transmits the data received from it (in parallel to MQTT). The
+         * server is started when the Port is enabled and the network is
+         * available.
+         * @param uart_n UART Port number to configure.
+         * @param tcp_port TCP port to listen on (0 to disable the server).
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_tcp(const uint8_t uart_n, const uint16_t tcp_port);
+
+        /**
+         * @brief Configure the flight recorder of an UART Port: the received
+         * data is kept in a circular history instead of being published,
+         * and it is dumped (pre-trigger and post-trigger windows) when a
+         * trigger fires.
+         * @param uart_n UART Port number to configure.
+         * @param size History size in bytes (0 to disable the recorder).
+         * @param post_size Post-trigger window size in bytes.
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_recorder(const uint8_t uart_n, const uint32_t size,
+                const uint32_t post_size);
+
+        /**
+         * @brief Add a pattern that fires the flight recorder trigger of an
+         * UART Port when a received frame contains it.
+         * @param uart_n UART Port number to configure.
+         * @param pattern Pattern string ("^" and "$" anchor it to the frame
+         * start and end), nullptr to remove all the trigger patterns.
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_recorder_match(const uint8_t uart_n,
+                const char* pattern);
+
+        /**
+         * @brief Configure a GPIO edge that fires the flight recorder
+         * trigger of an UART Port.
+         * @param uart_n UART Port number to configure.
+         * @param gpio GPIO number (-1 to remove the GPIO trigger).
+         * @param mode Edge (Arduino RISING, FALLING or CHANGE).
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_recorder_gpio(const uint8_t uart_n,
+                const int8_t gpio, const uint8_t mode);
+
+        /**
+         * @brief Fire the flight recorder trigger of an UART Port.
+         * @param uart_n UART Port number.
+         * @return true Trigger fired.
+         * @return false The recorder is not recording.
+         */
+        bool uart_recorder_trigger(const uint8_t uart_n);
+
+        /**
+         * @brief Select the capture engine of an UART Port (the capture
+         * is restarted if the Port is already enabled).
+         * @param uart_n UART Port number to configure.
+         * @param engine Capture engine to use.
+         * @return true Configuration success.
+         * @return false Configuration fail.
+         */
+        bool uart_config_engine(const uint8_t uart_n,
+                const ns_device::ns_uart::t_uart_engine engine);
+
+        /**
+         * @brief Enable or disable an UART Port to start being
+         * monitorized and logged.
+         * @param uart_n UART Port number to enable.
+         * @param enable Enable/Disable the UART Port.
+         * @return true Enable/Disable success.
+         * @return false Enable/Disable fail.
+         */
+        bool uart_enable(const uint8_t uart_n, const bool enable);
+
+        /**
+         * @brief Transmit a message through the specified UART Port.
+         * The UART Port must be already configured-enabled.
+         * @param uart_n UART Port number to Transmit the message.
+         * @param msg Message data to be transmitted.
+         * @return true Transmission success.
+         * @return false Transmission fail.
+         */
+        bool uart_tx_msg(const uint8_t uart_n, const char* msg);
+
+        /**
+         * @brief Queue a binary message to be transmitted through the
+         * specified UART Port (the message is rejected with a NACK if it
+         * doesn't fit in the Port Tx queue).
+         * The UART Port must be already configured-enabled.
+         * @param uart_n UART Port number to Transmit the message.
+         * @param data Message data to be transmitted.
+         * @param len Message number of bytes.
+         * @return true Message queued.
+         * @return false Message rejected.
+         */
+        bool uart_tx_msg(const uint8_t uart_n, const uint8_t* data,
+                const size_t len);
+
+        /**
+         * @brief Transmit multiple messages through the specified UART
+         * Port.
+         * The UART Port must be already configured-enabled.
+         * @param uart_n UART Port number to Transmit the messages.
+         * @param argc Number of messages to be transmitted.
+         * @param argv List of messages to be transmitted.
+         * @return true Transmission success.
+         * @return false Transmission fail.
+         */
+        bool uart_tx_msg(const uint8_t uart_n, int argc, char* argv[]);
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Handle reception of UART messages from the specified
+         * UART Port (drain all available received data and forward each
+         * received frame from UART to MQTT).
+         * @param uart_n UART Port number to handle.
+         * @return true Handle successs.
+         * @return false Handle fail.
+         */
+        bool handle_uart_rx(const uint8_t uart_n);
+
+        /**
+         * @brief Publish a received frame, or add it to the Port batch if
+         * batching is enabled.
+         * @param uart_n UART Port number of the frame.
+         * @param frame Frame data.
+         * @param len Frame length.
+         * @return true Frame published or batched.
+         * @return false Publish fail.
+         */
+        bool publish_frame(const uint8_t uart_n, const uint8_t* frame,
+                const uint32_t len);
+
+        /**
+         * @brief Publish the line events of an UART Port that happened
+         * before a position of its received data (the frame in progress is
+         * completed first).
+         * @param uart_n UART Port number.
+         * @param offset Rx ring buffer read counter of the position.
+         */
+        void rx_line_events(const uint8_t uart_n, const uint32_t offset);
+
+        /**
+         * @brief Report a line event of a Poll engine UART Port (called from
+         * the Arduino Serial events task).
+         * @param uart_n UART Port number.
+         * @param error Arduino Serial error.
+         */
+        void poll_line_event(const uint8_t uart_n,
+                const hardwareSerial_error_t error);
+
+        /**
+         * @brief Get the arrival time of a received byte and account it
+         * in the timestamps of the frame being received.
+         * @param uart_n UART Port number of the byte.
+         * @param offset Rx ring buffer read counter of the byte.
+         * @param char_time_us UART character time (us).
+         */
+        void rx_stamp(const uint8_t uart_n, const uint32_t offset,
+                const uint32_t char_time_us);
+
+        /**
+         * @brief Get the size of the timestamped record of a frame.
+         * @param uart_n UART Port number of the frame.
+         * @param len Frame length.
+         * @return uint32_t Record size.
+         */
+        uint32_t rx_record_size(const uint8_t uart_n, const uint32_t len);
+
+        /**
+         * @brief Write the timestamped record of a frame.
+         * @param uart_n UART Port number of the frame.
+         * @param frame Frame data.
+         * @param len Frame length.
+         * @param record Record output buffer (rx_record_size() bytes).
+         * @return uint32_t Record size.
+         */
+        uint32_t rx_record_write(const uint8_t uart_n, const uint8_t* frame,
+                const uint32_t len, uint8_t* record);
+
+        /**
+         * @brief Publish a self-delimited record of an UART Port, or add it
+         * to the Port batch if batching is enabled.
+         * @param uart_n UART Port number.
+         * @param record Record data.
+         * @param size Record size.
+         * @return true Record published or batched.
+         * @return false Publish fail.
+         */
+        bool publish_record(const uint8_t uart_n, const uint8_t* record,
+                const uint32_t size);
+
+        /**
+         * @brief Add the timestamped record of a frame received by a paired
+         * Port to its pair queue, and merge the pair queues (the oldest
+         * records are published first if there is no room for it).
+         * @param uart_n UART Port number of the frame.
+         * @param frame Frame data.
+         * @param len Frame length.
+         * @return true Frame queued.
+         * @return false Frame doesn't fit in the pair queue.
+         */
+        bool pair_push(const uint8_t uart_n, const uint8_t* frame,
+                const uint32_t len);
+
+        /**
+         * @brief Publish the queued records of a pair in timestamp order,
+         * while the order is known (both Ports have records queued) or the
+         * reorder window of the oldest record has elapsed.
+         * @param uart_n Primary (lower number) UART Port of the pair.
+         * @param flush Publish all the queued records.
+         */
+        void pair_merge(const uint8_t uart_n, const bool flush);
+
+        /**
+         * @brief Get the timestamp of the oldest record in a pair queue.
+         * @param uart_n UART Port number.
+         * @param t_us Timestamp output.
+         * @return true The Port has a queued record.
+         * @return false The queue is empty.
+         */
+        bool pair_head_time(const uint8_t uart_n, int64_t* t_us);
+
+        /**
+         * @brief Publish (through the primary Port of the pair) and remove
+         * the oldest record of a pair queue.
+         * @param uart_n UART Port number.
+         */
+        void pair_pop(const uint8_t uart_n);
+
+        /**
+         * @brief Publish the pending batch of frames of an UART Port.
+         * @param uart_n UART Port number.
+         * @return true Batch published.
+         * @return false Nothing to publish or publish fail.
+         */
+        bool batch_flush(const uint8_t uart_n);
+
+        /**
+         * @brief Publish the pending batch of frames of an UART Port if
+         * its maximum latency has elapsed.
+         * @param uart_n UART Port number.
+         */
+        void handle_batch_timeout(const uint8_t uart_n);
+
+        /**
+         * @brief Check if a Rx frame of an UART Port repeats the previous
+         * one, suppressing it if so.
+         * @param uart_n UART Port number.
+         * @param frame Frame data.
+         * @param len Frame length.
+         * @return true The frame was suppressed.
+         * @return false The frame must be published.
+         */
+        bool dedup_check(const uint8_t uart_n, const uint8_t* frame,
+                const uint32_t len);
+
+        /**
+         * @brief Publish the summary of the suppressed repeated frames of an
+         * UART Port (if any).
+         * @param uart_n UART Port number.
+         * @return true Publish success.
+         * @return false Nothing to publish or publish fail.
+         */
+        bool dedup_flush(const uint8_t uart_n);
+
+        /**
+         * @brief Publish the summary of the suppressed repeated frames of an
+         * UART Port if its collapsing window has elapsed.
+         * @param uart_n UART Port number.
+         */
+        void handle_dedup_timeout(const uint8_t uart_n);
+
+        /**
+         * @brief Encode a Rx log line of an UART Port with its template and
+         * publish it through the frames path.
+         * @param uart_n UART Port number.
+         * @param frame Line data.
+         * @param len Line length.
+         * @return true Publish success.
+         * @return false Publish fail.
+         */
+        bool publish_template(const uint8_t uart_n, const uint8_t* frame,
+                const uint32_t len);
+
+        /**
+         * @brief Publish the templates of an UART Port (retained) if they
+         * have changed since they were last published.
+         * @param uart_n UART Port number.
+         */
+        void handle_templates(const uint8_t uart_n);
+
+        /**
+         * @brief Handle the automatic baud rate detection of an UART Port:
+         * configure the Port speed when it is detected.
+         * @param uart_n UART Port number to handle.
+         */
+        void handle_autobaud(const uint8_t uart_n);
+
+        /**
+         * @brief Handle the Rx overload of an UART Port: update its state
+         * from the capture and publish rates, apply the Port overload
+         * policy and report its transitions.
+         * @param uart_n UART Port number to handle.
+         */
+        void handle_overload(const uint8_t uart_n);
+
+        /**
+         * @brief Restart the Rx overload measure of an UART Port, leaving
+         * the overload (the capture is resumed and stops discarding data).
+         * @param uart_n UART Port number.
+         */
+        void overload_reset(const uint8_t uart_n);
+
+        /**
+         * @brief Flush the protocol decoder of an UART Port, publishing the
+         * records whose time has elapsed (i.e. timeouts).
+         * @param uart_n UART Port number to handle.
+         */
+        void handle_decoder(const uint8_t uart_n);
+
+        /**
+         * @brief Protocol decoders records sink: publish a record to the
+         * decoder topic of the UART Port (or to a subtopic of it).
+         * @param ctx Decoder topic of the UART Port.
+         * @param subtopic Subtopic (nullptr for the decoder topic).
+         * @param record Record data.
+         * @param len Record length.
+         * @return true Publish success.
+         * @return false Publish fail.
+         */
+        static bool decoder_sink(void* ctx, const char* subtopic,
+                const uint8_t* record, const uint32_t len);
+
+        /**
+         * @brief Get the line and capture settings of an UART Port from its
+         * configuration (resolving Port default pins and profile).
+         * @param uart_n UART Port number.
+         * @param line Line settings output.
+         */
+        void get_line_settings(const uint8_t uart_n,
+                UARTCapture::s_line* line);
+
+        /**
+         * @brief Get the duration of an UART character at the Port
+         * configured speed and format.
+         * @param uart_n UART Port number.
+         * @return uint32_t Character time in microseconds.
+         */
+        uint32_t uart_char_time_us(const uint8_t uart_n);
+
+        /**
+         * @brief Apply the UART hardware Rx timeout required by the framing
+         * mode of a Port (so idle gaps are notified by the capture engine).
+         * @param uart_n UART Port number.
+         */
+        void apply_rx_timeout(const uint8_t uart_n);
+
+        /**
+         * @brief Move the data received by the Poll capture engine Ports
+         * from the Serial Ports to their Rx ring buffers.
+         */
+        void capture_poll();
+
+        /**
+         * @brief Handle the flight recorder of an UART Port: fire the GPIO
+         * trigger and publish the next chunk of a pending dump.
+         * @param uart_n UART Port number to handle.
+         */
+        void handle_recorder(const uint8_t uart_n);
+
+        /**
+         * @brief Flight recorder trigger GPIO interrupt handler.
+         * @param arg Trigger fired flag of the UART Port.
+         */
+        static void rec_gpio_isr(void* arg);
+
+        /**
+         * @brief Join command arguments with spaces (i.e. a pattern that
+         * contains spaces).
+         * @param argc Number of arguments.
+         * @param argv Arguments.
+         * @param first First argument to join.
+         * @param out Buffer to store the joined string.
+         * @param size Buffer size.
+         * @return true Arguments joined.
+         * @return false No arguments or the joined string doesn't fit.
+         */
+        static bool args_join(int argc, char* argv[], const int first,
+                char* out, const size_t size);
+
+        /**
+         * @brief Handle the transmission of an UART Port: move the Tx queue
+         * data to the Serial Port (Poll engine) and publish the pending Tx
+         * echoes batch when its latency has elapsed.
+         * @param uart_n UART Port number to handle.
+         */
+        void handle_uart_tx(const uint8_t uart_n);
+
+        /**
+         * @brief Handle the raw TCP serial server of an UART Port: start or
+         * stop it following the Port and network state, accept the client
+         * and move the client data to the Tx queue.
+         * @param uart_n UART Port number to handle.
+         */
+        void handle_uart_tcp(const uint8_t uart_n);
+
+        /**
+         * @brief Add data to the Tx queue of an UART Port and notify the
+         * capture engine to transmit it.
+         * @param uart_n UART Port number to transmit.
+         * @param data Data to be transmitted.
+         * @param size Number of bytes to transmit.
+         */
+        void uart_tx_queue(const uint8_t uart_n, const uint8_t* data,
+                const uint32_t size);
+
+        /**
+         * @brief Add a queued Tx message to the Tx echo of an UART Port.
+         * @param uart_n UART Port number.
+         * @param data Message data.
+         * @param len Message number of bytes.
+         */
+        void tx_echo(const uint8_t uart_n, const uint8_t* data,
+                const uint32_t len);
+
+        /**
+         * @brief Publish the pending Tx echo of an UART Port.
+         * @param uart_n UART Port number.
+         * @return true Echo published.
+         * @return false Nothing to publish or publish fail.
+         */
+        bool tx_echo_flush(const uint8_t uart_n);
+
+        /**
+         * @brief Get the Rx ring buffer size of an UART Port (configured, or
+         * derived from its speed and publish stall time).
+         * @param uart_n UART Port number.
+         * @return uint32_t Rx ring buffer size (power of two).
+         */
+        uint32_t rx_ring_size(const uint8_t uart_n);
+
+        /**
+         * @brief Get the number of bytes received by an UART Port at its
+         * speed during its publish stall time.
+         * @param uart_n UART Port number.
+         * @param max_size Maximum number of bytes to get.
+         * @return uint32_t Number of bytes (limited to max_size).
+         */
+        uint32_t rx_stall_size(const uint8_t uart_n, const uint32_t max_size);
+
+        /**
+         * @brief Allocate the Rx memory (ring buffer and framer buffer) of
+         * an UART Port, if it is not allocated with the same size yet, and
+         * its templates table if template encoding is configured.
+         * @param uart_n UART Port number.
+         * @return true Memory allocated.
+         * @return false Memory allocation fail.
+         */
+        bool rx_memory_alloc(const uint8_t uart_n);
+
+        /**
+         * @brief Release the Rx memory of an UART Port (templates table
+         * included).
+         * @param uart_n UART Port number.
+         */
+        void rx_memory_free(const uint8_t uart_n);
+
+        /**
+         * @brief Allocate the Tx queue memory of an UART Port, if it is not
+         * allocated with the configured size yet. The capture of the Port
+         * must be stopped.
+         * @param uart_n UART Port number.
+         * @return true Memory allocated.
+         * @return false Memory allocation fail.
+         */
+        bool tx_memory_alloc(const uint8_t uart_n);
+
+        /**
+         * @brief Allocate the buffers of the features configured for an
+         * UART Port, and release the buffers of the features that are off.
+         * @param uart_n UART Port number.
+         * @return true Buffers allocated.
+         * @return false Memory allocation fail of some buffer.
+         */
+        bool port_memory_alloc(const uint8_t uart_n);
+
+        /**
+         * @brief Release all the memory of an UART Port (Rx memory, Tx queue
+         * and features buffers). The capture of the Port must be stopped.
+         * @param uart_n UART Port number.
+         */
+        void port_memory_free(const uint8_t uart_n);
+
+        /**
+         * @brief Allocate a memory block (from PSRAM on boards that have
+         * it).
+         * @param size Block size.
+         * @return uint8_t* Allocated memory (nullptr if allocation fail).
+         */
+        uint8_t* mem_alloc(const size_t size);
+
+        /**
+         * @brief Allocate a buffer if it is needed and not allocated yet,
+         * or release it if it is not needed.
+         * @param memory Pointer to the buffer pointer.
+         * @param size Buffer size.
+         * @param needed The buffer is needed.
+         * @return true The buffer is allocated if needed.
+         * @return false Memory allocation fail.
+         */
+        bool mem_update(uint8_t** memory, const size_t size,
+            const bool needed);
+
+        /**
+         * @brief Start the capture engine of an UART Port.
+         * @param uart_n UART Port number to start.
+         * @return true Capture started.
+         * @return false Capture start fail.
+         */
+        bool capture_start(const uint8_t uart_n);
+
+        /**
+         * @brief Stop the capture engine of an UART Port.
+         * @param uart_n UART Port number to stop.
+         */
+        void capture_stop(const uint8_t uart_n);
+
+        /**
+         * @brief Restart the capture of an UART Port to apply a new
+         * configuration (if the Port is enabled). The Port is disabled if
+         * it can't be restarted.
+         * @param uart_n UART Port number to restart.
+         * @return true Capture restarted (or Port not enabled).
+         * @return false Capture restart fail.
+         */
+        bool capture_restart(const uint8_t uart_n);
+
+        /**
+         * @brief Publish the UART Status informationan MQTT message.
+         * @return true Publish success.
+         * @return false Publish fail.
+         */
+        bool mqtt_send_uart_status_info();
+
+        /**
+         * @brief Publish an UART Rx overload report through the UART Status
+         * topic.
+         * @param uart_n UART Port number.
+         * @param event Overload event to report.
+         * @return true Publish success.
+         * @return false Publish fail.
+         */
+        bool mqtt_send_uart_overload_info(const uint8_t uart_n,
+                const UARTOverload::t_event event);
+
+        /**
+         * @brief Send an UART Rx message to the component MQTT.
+         * @param uart_n UART Port number to publish on it MQTT Topic.
+         * @param msg Message payload data to send (binary safe).
+         * @param len Message payload number of bytes.
+         * @return true Publish success.
+         * @return false Publish fail.
+         */
+        bool mqtt_publish_rx(const uint8_t uart_n, const uint8_t* msg,
+                const size_t len);
+
+        /**
+         * @brief Send an UART Tx echo message to the component MQTT.
+         * @param uart_n UART Port number to publish on it MQTT Topic.
+         * @param msg Message payload data to send (binary safe).
+         * @param len Message payload number of bytes.
+         * @return true Publish success.
+         * @return false Publish fail.
+         */
+        bool mqtt_publish_tx(const uint8_t uart_n, const uint8_t* msg,
+                const size_t len);
+
+        /**
+         * @brief Send a Tx message rejection (NACK) through the UART
+         * Configuration topic.
+         * @param uart_n UART Port number of the rejected message.
+         * @param len Rejected message number of bytes.
+         * @return true Publish success.
+         * @return false Publish fail.
+         */
+        bool mqtt_send_tx_nack(const uint8_t uart_n, const size_t len);
+
+    /******************************************************************/
+
+    /* Public Attributes */
+
+    public:
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Component initialized status (init() method was call).
+         */
+        bool initialized;
+
+        /**
+         * @brief Pointers to Serial Ports to use.
+         */
+        HardwareSerial* SerialPort[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Event-Driven capture engine (ESP-IDF UART Driver events
+         * queue and capture tasks).
+         */
+        UARTCapture Capture;
+
+        /**
+         * @brief Rx ring buffers between the capture side (capture task or
+         * poll) and the publisher side (process()) of each UART Port.
+         */
+        UARTRingBuffer rx_ring[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Rx memory of each UART Port: the Rx ring buffer storage
+         * followed by the framer buffer (allocated while the Port is
+         * enabled).
+         */
+        uint8_t* rx_memory[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Tx queues between the MQTT/CLI messages reception and the
+         * capture engine of each UART Port.
+         */
+        UARTRingBuffer tx_ring[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Storage memory of the Tx queues (allocated while the Port
+         * is enabled).
+         */
+        uint8_t* tx_ring_memory[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Number of Tx messages rejected due to Tx queue full.
+         */
+        uint32_t tx_num_rejected[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Raw TCP serial servers of each UART Port.
+         */
+        UARTTCPServer tcp_server[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Time of the last TCP serial server start attempt (ms).
+         */
+        unsigned long t_tcp_start[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Tx echoes pending to be published (MAX_TX_ECHO_SIZE bytes,
+         * allocated while the Port is enabled with Tx echo).
+         */
+        uint8_t* tx_echo_data[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Number of bytes of the pending Tx echoes.
+         */
+        uint32_t tx_echo_len[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Time instant when the first Tx echo was added to each
+         * pending batch.
+         */
+        uint32_t t_tx_echo_start[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Arrival time marks of the data of the Rx ring buffers.
+         */
+        UARTTimestamps rx_marks[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Line events queued by the capture side of each UART Port.
+         */
+        UARTLineEvents rx_events[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Rx frames filters of each UART Port.
+         */
+        UARTFilter rx_filter[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Flight recorders of each UART Port.
+         */
+        UARTRecorder recorder[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Automatic baud rate detection of each UART Port.
+         */
+        UARTAutobaud autobaud[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Rx overload detector of each UART Port.
+         */
+        UARTOverload overload[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Capture of each UART Port paused by its overload policy.
+         */
+        bool rx_pause[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Each UART Port discards the data that can't be stored in
+         * its Rx ring buffer by its overload policy.
+         */
+        bool rx_discard[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Flight recorder trigger patterns of each UART Port.
+         */
+        UARTFilter rec_match[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Rx log lines template miners of each UART Port.
+         */
+        UARTTemplates rx_templates[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Template encoded Rx log line buffers (TPL_DATA_SIZE bytes,
+         * allocated while the Port is enabled with template encoding).
+         */
+        uint8_t* tpl_data[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Rx messages compressors of each UART Port.
+         */
+        UARTCompressor compressor[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Compressed Rx message buffers (CMP_DATA_SIZE bytes,
+         * allocated while the Port is enabled with compression).
+         */
+        uint8_t* cmp_data[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Protocol decoders storage of each UART Port (one decoder
+         * at a time, of any registered type).
+         */
+        alignas(UARTDecoders::STORAGE_ALIGN) uint8_t decoder_storage
+            [ns_const::MAX_NUM_UART][UARTDecoders::STORAGE_SIZE];
+
+        /**
+         * @brief Protocol decoder of each UART Port (nullptr if none).
+         */
+        UARTDecoder* decoder[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Flight recorder GPIO trigger fired flags (set from the GPIO
+         * interrupt).
+         */
+        volatile bool rec_gpio_fired[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Extra flags of the next timestamped record of each UART
+         * Port.
+         */
+        uint8_t rx_record_flags[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief MQTT Topic to send UARTs status information.
+         * The device publish current UARTs configurations periodically.
+         */
+        char topic_status[MQTT_TOPIC_MAX_LEN];
+
+        /**
+         * @brief MQTT Topics to configure-enable an UART Port remotely.
+         */
+        char topic_cfg[ns_const::MAX_NUM_UART][MQTT_TOPIC_MAX_LEN];
+
+        /**
+         * @brief MQTT Topics to send UART Rx message.
+         */
+        char topic_rx[ns_const::MAX_NUM_UART][MQTT_TOPIC_MAX_LEN];
+
+        /**
+         * @brief MQTT Topics to send UART Tx message.
          */
         char topic_tx[ns_const::MAX_NUM_UART][MQTT_TOPIC_MAX_LEN];
 
         /**
-         * @brief Received UART data buffers.
+         * @brief MQTT Topics to send UART Tx echo messages.
+         */
+        char topic_tx_echo[ns_const::MAX_NUM_UART][MQTT_TOPIC_MAX_LEN];
+
+        /**
+         * @brief MQTT Topics to send UART flight recorder dumps.
+         */
+        char topic_rec[ns_const::MAX_NUM_UART][MQTT_TOPIC_MAX_LEN];
+
+        /**
+         * @brief MQTT Topics to send UART Rx log lines templates.
+         */
+        char topic_templates[ns_const::MAX_NUM_UART][MQTT_TOPIC_MAX_LEN];
+
+        /**
+         * @brief MQTT Topics to send UART protocol decoder records (the
+         * subtopics are appended when they are published).
+         */
+        char topic_decoder[ns_const::MAX_NUM_UART][MQTT_TOPIC_MAX_LEN];
+
+        /**
+         * @brief Rx data stream framers of each UART Port.
+         */
+        UARTFramer framer[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Time instant when last UART data was handled from each
+         * Port (for IDLE framing).
+         */
+        uint32_t t_last_rx_us[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Arrival time of the first byte of the frame being
+         * received from each Port (us).
+         */
+        int64_t t_frame_us[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Arrival time of the last byte received from each Port
+         * (us).
+         */
+        int64_t t_prev_byte_us[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Inter-arrival deltas of the bytes of the frame being
+         * received from each Port (us, 2 bytes little endian each as they
+         * are written in the records, allocated while the Port is enabled
+         * with deltas timestamps).
+         */
+        uint8_t* frame_deltas[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Number of inter-arrival deltas of the frame being
+         * received from each Port.
+         */
+        uint32_t num_frame_deltas[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Pair queues of timestamped frame records waiting to be
+         * merged (PAIR_QUEUE_SIZE bytes, allocated while the Port is enabled
+         * and paired).
+         */
+        uint8_t* pair_data[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Position of the oldest record in each pair queue.
+         */
+        uint32_t pair_head[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Position after the newest record in each pair queue.
+         */
+        uint32_t pair_tail[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Batches of Rx frames pending to be published, also used to
+         * build the timestamped records (MAX_BATCH_SIZE bytes, allocated
+         * while the Port is enabled with batching or timestamps).
+         */
+        uint8_t* batch_data[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Number of bytes of the pending batches.
+         */
+        uint32_t batch_len[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Time instant when the first frame was added to each
+         * pending batch.
+         */
+        uint32_t t_batch_start[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Maximum number of bytes drained from each UART Port in
+         * a single reception handling pass (since last status report).
+         */
+        uint32_t rx_burst_max[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Sequence number of the next Rx message of each UART Port.
+         */
+        uint32_t rx_seq_n[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Number of Rx stream bytes (messages payload) of each UART
+         * Port published or dropped since boot.
+         */
+        uint64_t rx_stream_offset[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Number of Rx messages of each UART Port that failed to be
+         * published (dropped).
+         */
+        uint32_t rx_num_pub_fail[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Hash (FNV-1a) and length of the last published frame of
+         * each UART Port.
+         */
+        uint32_t dedup_hash[ns_const::MAX_NUM_UART];
+        uint32_t dedup_len[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Number of suppressed repetitions of the last published
+         * frame (pending to be summarized).
+         */
+        uint32_t dedup_count[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Time of the last frame equal to the last published one and
+         * time of the first suppressed repetition (ms).
+         */
+        unsigned long t_dedup_last[ns_const::MAX_NUM_UART];
+        unsigned long t_dedup_start[ns_const::MAX_NUM_UART];
+
+        /**
+         * @brief Arrival time of the first and last suppressed repetitions
+         * (us).
          */
-        uint8_t rx_data[ns_const::MAX_NUM_UART][DATA_RX_BUFFER_SIZE];
+        int64_t t_dedup_first_us[ns_const::MAX_NUM_UART];
+        int64_t t_dedup_last_us[ns_const::MAX_NUM_UART];
 
         /**
-         * @brief Number of bytes stored in received UART data buffers.
+         * @brief Total number of suppressed repeated frames.
          */
-        uint32_t num_data_rx[ns_const::MAX_NUM_UART];
+        uint32_t dedup_num_suppressed[ns_const::MAX_NUM_UART];
 
         /**
          * @brief UART Port Number to send on the UART Status
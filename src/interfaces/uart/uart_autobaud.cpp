@@ -0,0 +1,183 @@
+/**
+ * @file    uart_autobaud.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART automatic baud rate detection source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_autobaud.h"
+
+// ESP-IDF UART Low Level Access
+#include "hal/uart_ll.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes an idle detection
+ * without detected rate.
+ */
+UARTAutobaud::UARTAutobaud()
+{
+    uart_num = UART_NUM_0;
+    state = t_state::IDLE;
+    t_start = 0U;
+    timeout_ms = 0U;
+    rate = 0U;
+}
+
+/**
+ * @details This function enables the autobaud hardware of the UART from a
+ * clean measure.
+ */
+void UARTAutobaud::start(const uart_port_t uart_num, const uint32_t timeout_ms)
+{
+    this->uart_num = uart_num;
+    this->timeout_ms = timeout_ms;
+    t_start = millis();
+    rate = 0U;
+    state = t_state::DETECTING;
+    measure_restart();
+}
+
+/**
+ * @details This function disables the autobaud hardware of the UART.
+ */
+void UARTAutobaud::stop()
+{
+    if (state == t_state::DETECTING)
+    {   uart_ll_set_autobaud_en(UART_LL_GET_HW(uart_num), false);   }
+    state = t_state::IDLE;
+}
+
+/**
+ * @details When the measure has enough Rx line edges, the narrowest of the
+ * low and high pulses is taken as the bit width (the UART clock is the APB
+ * clock, and the pulse counters are one cycle short). The measure is
+ * restarted if its rate is not a standard one, and the detection fails if
+ * no rate was detected before the timeout.
+ */
+bool UARTAutobaud::poll()
+{
+    // Do nothing if there is no detection in progress
+    if (state != t_state::DETECTING)
+    {   return false;   }
+
+    uart_dev_t* hw = UART_LL_GET_HW(uart_num);
+    if (uart_ll_get_rxd_edge_cnt(hw) >= MIN_EDGES)
+    {
+        uint32_t pulse = uart_ll_get_low_pulse_cnt(hw);
+        uint32_t high_pulse = uart_ll_get_high_pulse_cnt(hw);
+        if (high_pulse < pulse)
+        {   pulse = high_pulse;   }
+
+        rate = snap(getApbFrequency() / (pulse + 1U));
+        if (rate != 0U)
+        {
+            uart_ll_set_autobaud_en(hw, false);
+            state = t_state::DETECTED;
+            return true;
+        }
+        measure_restart();
+    }
+
+    if (millis() - t_start >= timeout_ms)
+    {
+        uart_ll_set_autobaud_en(hw, false);
+        state = t_state::FAILED;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @details Getter method to return the detection state.
+ */
+UARTAutobaud::t_state UARTAutobaud::get_state()
+{
+    return state;
+}
+
+/**
+ * @details Getter method to return the last detected rate.
+ */
+uint32_t UARTAutobaud::get_rate()
+{
+    return rate;
+}
+
+/**
+ * @details The nearest standard rate is the one with the lowest relative
+ * deviation from the measured rate.
+ */
+uint32_t UARTAutobaud::snap(const uint32_t measured)
+{
+    uint32_t nearest = 0U;
+    uint64_t nearest_dev = UINT64_MAX;
+    for (uint32_t std_rate : STD_RATES)
+    {
+        uint64_t dev = (measured > std_rate) ?
+            (uint64_t)(measured - std_rate) : (uint64_t)(std_rate - measured);
+        dev = (dev * 1000U) / std_rate;
+        if (dev < nearest_dev)
+        {
+            nearest = std_rate;
+            nearest_dev = dev;
+        }
+    }
+
+    if (nearest_dev > (TOLERANCE_PCT * 10U))
+    {   return 0U;   }
+
+    return nearest;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details The hardware keeps the minimum pulse widths and the edges count
+ * since it was enabled, so it is disabled and enabled again.
+ */
+void UARTAutobaud::measure_restart()
+{
+    uart_dev_t* hw = UART_LL_GET_HW(uart_num);
+    uart_ll_set_autobaud_en(hw, false);
+    uart_ll_set_autobaud_en(hw, true);
+}
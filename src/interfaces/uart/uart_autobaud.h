@@ -0,0 +1,224 @@
+/**
+ * @file    uart_autobaud.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART automatic baud rate detection header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_AUTOBAUD_H
+#define UART_AUTOBAUD_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+// Arduino Framework
+#include <Arduino.h>
+
+// ESP-IDF UART Driver
+#include "driver/uart.h"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief UART automatic baud rate detection. It uses the autobaud hardware
+ * of the UART, that measures the minimum width of the low and high pulses
+ * of the Rx line (in UART clock cycles): the narrowest pulse is a single
+ * bit, so its width gives the line speed, that is snapped to the nearest
+ * standard rate. A measure that doesn't match any standard rate (i.e. a
+ * glitch or a line without single bit pulses yet) is discarded and a new
+ * one is started, until the detection timeout.
+ * The UART must be configured (with its Rx pin) while detecting.
+ */
+class UARTAutobaud
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+    public:
+
+        /**
+         * @brief Maximum detection timeout (ms).
+         */
+        static constexpr uint32_t MAX_TIMEOUT_MS = 60000U;
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Number of Rx line edges of each measure (about 10
+         * characters, so they have single bit pulses of both levels).
+         */
+        static constexpr uint32_t MIN_EDGES = 100U;
+
+        /**
+         * @brief Maximum deviation from a standard rate (%).
+         */
+        static constexpr uint32_t TOLERANCE_PCT = 5U;
+
+        /**
+         * @brief Standard rates.
+         */
+        static constexpr uint32_t STD_RATES[] =
+        {
+            300U, 600U, 1200U, 2400U, 4800U, 9600U, 14400U, 19200U, 28800U,
+            38400U, 57600U, 74880U, 115200U, 230400U, 250000U, 460800U,
+            500000U, 921600U, 1000000U, 1500000U, 2000000U, 3000000U
+        };
+
+    /******************************************************************/
+
+    /* Public Data Types */
+
+    public:
+
+        /**
+         * @brief Detection state.
+         */
+        enum class t_state : uint8_t
+        {
+            IDLE = 0U,
+            DETECTING = 1U,
+            DETECTED = 2U,
+            FAILED = 3U
+        };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new Autobaud object (idle).
+         */
+        UARTAutobaud();
+
+        /**
+         * @brief Start a detection (any detection in progress is restarted).
+         * @param uart_num UART hardware number.
+         * @param timeout_ms Detection timeout (ms).
+         */
+        void start(const uart_port_t uart_num, const uint32_t timeout_ms);
+
+        /**
+         * @brief Stop the detection in progress (the state becomes idle).
+         */
+        void stop();
+
+        /**
+         * @brief Check the measure of the detection in progress.
+         * @return true The detection has finished (detected or failed).
+         * @return false The detection is not in progress or has not
+         * finished yet.
+         */
+        bool poll();
+
+        /**
+         * @brief Get the detection state.
+         * @return t_state Detection state.
+         */
+        t_state get_state();
+
+        /**
+         * @brief Get the last detected rate.
+         * @return uint32_t Detected rate (0 if none).
+         */
+        uint32_t get_rate();
+
+        /**
+         * @brief Get the nearest standard rate of a measured rate.
+         * @param measured Measured rate.
+         * @return uint32_t Standard rate (0 if none is within the
+         * tolerance).
+         */
+        static uint32_t snap(const uint32_t measured);
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Restart the autobaud hardware measure (it keeps the
+         * minimum pulse widths since it was enabled).
+         */
+        void measure_restart();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief UART hardware number.
+         */
+        uart_port_t uart_num;
+
+        /**
+         * @brief Detection state.
+         */
+        t_state state;
+
+        /**
+         * @brief Detection start time (ms) and timeout (ms).
+         */
+        uint32_t t_start;
+        uint32_t timeout_ms;
+
+        /**
+         * @brief Last detected rate.
+         */
+        uint32_t rate;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_AUTOBAUD_H */
@@ -0,0 +1,574 @@
+/**
+ * @file    uart_capture.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Event-Driven Capture Engine source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_capture.h"
+
+// ESP-IDF High Resolution Timer
+#include "esp_timer.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes the capture state of all
+ * the Ports to default values.
+ */
+UARTCapture::UARTCapture()
+{
+    for (uint8_t i = 0U; i < ns_const::MAX_NUM_UART; i++)
+    {
+        ports[i].uart_n = i;
+        ports[i].running = false;
+        ports[i].stop_request = false;
+        ports[i].task = nullptr;
+        ports[i].event_queue = nullptr;
+        ports[i].ring = nullptr;
+        ports[i].marks = nullptr;
+        ports[i].events = nullptr;
+        ports[i].tx_ring = nullptr;
+        ports[i].t_tx_retry = 1;
+        ports[i].num_fifo_ovf = 0U;
+        ports[i].num_buffer_full = 0U;
+        ports[i].bridge = nullptr;
+        ports[i].discard = false;
+        ports[i].paused = false;
+        ports[i].rts_flow = false;
+    }
+}
+
+/**
+ * @details This function installs the ESP-IDF UART Driver for the Port with
+ * an events queue and the provided line settings (speed, format, pins, flow
+ * control, Rx buffer and FIFO threshold), enables the End Of Line pattern
+ * detection and launch the Port capture task pinned to the capture core, that
+ * will write the captured data into the provided Rx ring buffer (and its
+ * arrival time marks into the provided timestamps queue, if any) and transmit
+ * the data of the provided Tx queue. The frame error interrupt (not enabled
+ * by the Driver by default) is enabled to report it as a line event.
+ */
+bool UARTCapture::start(const uint8_t uart_n, const s_line* line,
+        UARTRingBuffer* ring, UARTTimestamps* marks, UARTRingBuffer* tx_ring,
+        UARTLineEvents* events)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    // Do nothing if there is no line settings or Rx ring buffer to write to
+    if ( (line == nullptr) || (ring == nullptr) )
+    {   return false;   }
+
+    s_port* port = &(ports[uart_n]);
+    uart_port_t uart_num = (uart_port_t)(uart_n);
+
+    // Restart the capture if it is already running
+    if (port->running)
+    {   stop(uart_n);   }
+
+    // Install the UART Driver
+    if (uart_driver_install(uart_num, line->driver_rx_buffer_size, 0,
+            EVENT_QUEUE_LEN, &(port->event_queue), 0) != ESP_OK)
+    {   return false;   }
+    if ( (uart_param_config(uart_num, &(line->config)) != ESP_OK) ||
+         (uart_set_pin(uart_num, line->tx_pin, line->rx_pin, line->rts_pin,
+            line->cts_pin) != ESP_OK) ||
+         (uart_set_rx_full_threshold(uart_num,
+            (int)(line->rx_full_thresh)) != ESP_OK) )
+    {
+        uart_driver_delete(uart_num);
+        return false;
+    }
+
+    // The RTS flow control can hold the sender while the capture is paused
+    port->rts_flow = ((line->config.flow_ctrl & UART_HW_FLOWCTRL_RTS) != 0);
+
+    // Wake up the capture task on each End Of Line
+    uart_enable_pattern_det_baud_intr(uart_num, PATTERN_CHAR, 1, 1, 0, 0);
+    uart_pattern_queue_reset(uart_num, EVENT_QUEUE_LEN);
+
+    // Report frame errors too
+    uart_enable_intr_mask(uart_num, UART_INTR_FRAM_ERR);
+
+    // Time to send half of the Tx FIFO (at least one tick)
+    uint32_t baud_rate = (uint32_t)(line->config.baud_rate);
+    if (baud_rate == 0U)
+    {   baud_rate = ns_const::DEFAULT_UART_BAUD_RATE;   }
+    uint32_t t_tx_retry_ms = (TX_RETRY_FIFO_CHARS * 10U * 1000U) / baud_rate;
+    port->t_tx_retry = pdMS_TO_TICKS(t_tx_retry_ms);
+    if (port->t_tx_retry == 0)
+    {   port->t_tx_retry = 1;   }
+
+    // Launch the capture task
+    port->ring = ring;
+    port->marks = marks;
+    port->events = events;
+    port->tx_ring = tx_ring;
+    port->stop_request = false;
+    port->running = true;
+    if (xTaskCreatePinnedToCore(task_capture, "uart_capture",
+            TASK_STACK_SIZE, (void*)(port), TASK_PRIORITY, &(port->task),
+            TASK_CORE) != pdPASS)
+    {
+        port->running = false;
+        port->task = nullptr;
+        port->ring = nullptr;
+        port->marks = nullptr;
+        port->events = nullptr;
+        port->tx_ring = nullptr;
+        uart_driver_delete(uart_num);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @details This function requests the capture task of the Port to finish
+ * (injecting a wake up event into the UART Driver events queue), waits for
+ * it and then release the UART Driver resources.
+ */
+void UARTCapture::stop(const uint8_t uart_n)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return;   }
+
+    s_port* port = &(ports[uart_n]);
+
+    // Do nothing if the Port is not being captured
+    if (port->running == false)
+    {   return;   }
+
+    // Request the capture task to finish and wait for it
+    uart_event_t wake_event = {};
+    wake_event.type = UART_EVENT_MAX;
+    port->stop_request = true;
+    xQueueSend(port->event_queue, &wake_event, 0);
+    uint32_t t0 = millis();
+    while (port->running)
+    {
+        if (millis() - t0 >= T_TASK_STOP_TIMEOUT_MS)
+        {
+            vTaskDelete(port->task);
+            port->running = false;
+            break;
+        }
+        vTaskDelay(1);
+    }
+    port->task = nullptr;
+
+    // Release resources
+    uart_driver_delete((uart_port_t)(uart_n));
+    port->event_queue = nullptr;
+    port->ring = nullptr;
+    port->marks = nullptr;
+    port->events = nullptr;
+    port->tx_ring = nullptr;
+}
+
+/**
+ * @details This function posts a wake up event to the capture task of the
+ * Port (without waiting if its events queue is full, as the task will be
+ * woken up by that events anyway), so it starts transmitting the new data.
+ */
+void UARTCapture::notify_tx(const uint8_t uart_n)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return;   }
+
+    // Do nothing if the Port is not being captured
+    if (ports[uart_n].running == false)
+    {   return;   }
+
+    uart_event_t wake_event = {};
+    wake_event.type = UART_EVENT_MAX;
+    xQueueSend(ports[uart_n].event_queue, &wake_event, 0);
+}
+
+/**
+ * @details This function sets the capture state of the bridged Port as the
+ * destination of the data received by the Port (the bridge is kept while the
+ * Ports are restarted).
+ */
+void UARTCapture::set_bridge(const uint8_t uart_n, const uint8_t bridge_n)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return;   }
+
+    if ( (bridge_n >= ns_const::MAX_NUM_UART) || (bridge_n == uart_n) )
+    {   ports[uart_n].bridge = nullptr;   }
+    else
+    {   ports[uart_n].bridge = &(ports[bridge_n]);   }
+}
+
+/**
+ * @details This function sets the discard when full mode of the Port (the
+ * mode is kept while the Port is restarted).
+ */
+void UARTCapture::set_discard(const uint8_t uart_n, const bool discard)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return;   }
+
+    ports[uart_n].discard = discard;
+}
+
+/**
+ * @details This function sets the pause state of the Port. The capture task
+ * retries to move the data kept in the UART Driver periodically, so it is
+ * resumed without waiting for a new event.
+ */
+void UARTCapture::set_pause(const uint8_t uart_n, const bool pause)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return;   }
+
+    ports[uart_n].paused = pause;
+}
+
+/**
+ * @details Getter method to check the capture running state of a Port.
+ */
+bool UARTCapture::is_running(const uint8_t uart_n)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return false;   }
+
+    return ports[uart_n].running;
+}
+
+/**
+ * @details Getter method to get the Rx FIFO overflows counter of a Port.
+ */
+uint32_t UARTCapture::get_num_fifo_ovf(const uint8_t uart_n)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return 0U;   }
+
+    return ports[uart_n].num_fifo_ovf;
+}
+
+/**
+ * @details Getter method to get the UART Driver Rx buffer full events counter
+ * of a Port.
+ */
+uint32_t UARTCapture::get_num_buffer_full(const uint8_t uart_n)
+{
+    // Do nothing if specified UART Port number is invalid
+    if (uart_n >= ns_const::MAX_NUM_UART)
+    {   return 0U;   }
+
+    return ports[uart_n].num_buffer_full;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details The capture task sleeps until the UART Driver notifies an event,
+ * so no CPU time is used while the line is idle:
+ * - UART_DATA / UART_PATTERN_DET: Data received (Rx FIFO threshold, Rx
+ *   timeout or End Of Line detected), move it to the Rx ring buffer.
+ * - UART_BUFFER_FULL: The Driver ring buffer is full, drain it.
+ * - UART_FIFO_OVF: Hardware FIFO overflow, data was lost, so the Driver is
+ *   flushed and the events queue reset to recover the reception.
+ * - UART_PARITY_ERR / UART_FRAME_ERR / UART_BREAK: Line error or BREAK
+ *   condition, the data received before it is moved to the Rx ring buffer.
+ * Errors, BREAKs, overflows and Driver buffer full events are reported to the
+ * line events queue at the current position of the Rx ring buffer data.
+ * If the Rx ring buffer gets full, the data is kept in the UART Driver and
+ * the task retries periodically until the Interface makes room for it. If
+ * the UART Driver buffer gets full too, its data is discarded and accounted
+ * as dropped in the ring buffer, so the reception never stalls silently.
+ * After each event the Tx queue is moved to the UART Tx FIFO, and while it is
+ * not empty the task wakes up each time half of the FIFO should have been
+ * sent (the UART hardware holds the FIFO while CTS is not asserted).
+ */
+void UARTCapture::task_capture(void* arg)
+{
+    s_port* port = (s_port*)(arg);
+    uart_port_t uart_num = (uart_port_t)(port->uart_n);
+    uart_event_t event;
+    bool pending = false;
+    bool pending_tx = false;
+
+    while (port->stop_request == false)
+    {
+        TickType_t t_wait = portMAX_DELAY;
+        if (pending)
+        {   t_wait = pdMS_TO_TICKS(T_RETRY_DRAIN_MS);   }
+        if ( pending_tx && (port->t_tx_retry < t_wait) )
+        {   t_wait = port->t_tx_retry;   }
+
+        if (xQueueReceive(port->event_queue, (void*)(&event),
+                t_wait) != pdTRUE)
+        {
+            if (pending)
+            {   pending = drain_driver(port);   }
+            pending_tx = drain_tx(port);
+            continue;
+        }
+
+        switch (event.type)
+        {
+            case UART_DATA:
+                pending = drain_driver(port);
+                break;
+
+            case UART_PATTERN_DET:
+                // Positions are not needed, just keep the queue empty
+                while (uart_pattern_pop_pos(uart_num) != -1) {}
+                pending = drain_driver(port);
+                break;
+
+            case UART_BUFFER_FULL:
+                port->num_buffer_full = port->num_buffer_full + 1U;
+                pending = drain_driver(port);
+                if ( pending && ((!port->paused) || (!port->rts_flow)) )
+                {   pending = discard_driver(port);   }
+                line_event(port, UARTLineEvents::t_event::BUFFER_FULL);
+                break;
+
+            case UART_FIFO_OVF:
+                port->num_fifo_ovf = port->num_fifo_ovf + 1U;
+                uart_flush_input(uart_num);
+                xQueueReset(port->event_queue);
+                pending = false;
+                line_event(port, UARTLineEvents::t_event::FIFO_OVF);
+                break;
+
+            case UART_PARITY_ERR:
+                pending = drain_driver(port);
+                line_event(port, UARTLineEvents::t_event::PARITY_ERR);
+                break;
+
+            case UART_FRAME_ERR:
+                pending = drain_driver(port);
+                line_event(port, UARTLineEvents::t_event::FRAME_ERR);
+                break;
+
+            case UART_BREAK:
+                pending = drain_driver(port);
+                line_event(port, UARTLineEvents::t_event::BREAK);
+                break;
+
+            default:
+                break;
+        }
+
+        pending_tx = drain_tx(port);
+    }
+
+    port->running = false;
+    vTaskDelete(nullptr);
+}
+
+/**
+ * @details This function adds a line event to the Port events queue (if any)
+ * at the current Rx ring buffer write position.
+ */
+void UARTCapture::line_event(s_port* port, const UARTLineEvents::t_event type)
+{
+    if (port->events == nullptr)
+    {   return;   }
+
+    port->events->push(type, port->ring->get_write_count(),
+        esp_timer_get_time());
+}
+
+/**
+ * @details This function reads the data buffered in the UART Driver directly
+ * into the free regions of the Port Rx ring buffer (no intermediate copy),
+ * retransmitting it through the bridged Port (if any) before making it
+ * available to the Interface, and marking the arrival time of each read
+ * chunk. A bridged Port never keeps data in the UART Driver when the ring
+ * buffer is full (it is forwarded and discarded), so logging never delays
+ * the bridged link, and neither does a Port in discard mode. A paused Port
+ * keeps the data in the UART Driver if it has RTS flow control (to stop the
+ * sender), otherwise the data is discarded.
+ */
+bool UARTCapture::drain_driver(s_port* port)
+{
+    uart_port_t uart_num = (uart_port_t)(port->uart_n);
+    size_t num_buffered = 0U;
+
+    if (port->paused)
+    {
+        if (port->rts_flow)
+        {   return true;   }
+        return discard_driver(port);
+    }
+
+    uart_get_buffered_data_len(uart_num, &num_buffered);
+    while (num_buffered > 0U)
+    {
+        uint8_t* ptr = nullptr;
+        uint32_t region = port->ring->write_region(&ptr);
+        if (region == 0U)
+        {
+            if ( (port->bridge != nullptr) || port->discard )
+            {   return discard_driver(port);   }
+            return true;
+        }
+
+        uint32_t to_read = (uint32_t)(num_buffered);
+        if (to_read > region)
+        {   to_read = region;   }
+
+        int num_read = uart_read_bytes(uart_num, ptr, to_read, 0);
+        if (num_read <= 0)
+        {   break;   }
+        forward(port, ptr, (uint32_t)(num_read));
+        port->ring->write_commit((uint32_t)(num_read));
+        if (port->marks != nullptr)
+        {
+            port->marks->push(port->ring->get_write_count(),
+                    esp_timer_get_time());
+        }
+
+        num_buffered = num_buffered - (size_t)(num_read);
+    }
+
+    return false;
+}
+
+/**
+ * @details This function reads and discards all the data buffered in the
+ * UART Driver (retransmitting it through the bridged Port, if any),
+ * accounting it in the ring buffer overflow drop counter.
+ */
+bool UARTCapture::discard_driver(s_port* port)
+{
+    uart_port_t uart_num = (uart_port_t)(port->uart_n);
+    uint8_t discard[DISCARD_CHUNK_SIZE];
+    size_t num_buffered = 0U;
+
+    uart_get_buffered_data_len(uart_num, &num_buffered);
+    while (num_buffered > 0U)
+    {
+        uint32_t to_read = (uint32_t)(num_buffered);
+        if (to_read > DISCARD_CHUNK_SIZE)
+        {   to_read = DISCARD_CHUNK_SIZE;   }
+
+        int num_read = uart_read_bytes(uart_num, discard, to_read, 0);
+        if (num_read <= 0)
+        {   break;   }
+        forward(port, discard, (uint32_t)(num_read));
+        port->ring->drop((uint32_t)(num_read));
+
+        num_buffered = num_buffered - (size_t)(num_read);
+    }
+
+    return false;
+}
+
+/**
+ * @details This function writes the data of the Port Tx queue directly from
+ * the queue memory into the free space of the UART Tx FIFO (no intermediate
+ * copy and no wait for the data to be sent).
+ */
+bool UARTCapture::drain_tx(s_port* port)
+{
+    // Do nothing if the Port has no Tx queue
+    if (port->tx_ring == nullptr)
+    {   return false;   }
+
+    const uint8_t* ptr = nullptr;
+    uint32_t region = port->tx_ring->read_region(&ptr);
+    while (region > 0U)
+    {
+        int num_sent = uart_tx_chars((uart_port_t)(port->uart_n),
+            (const char*)(ptr), region);
+        if (num_sent <= 0)
+        {   break;   }
+        port->tx_ring->consume((uint32_t)(num_sent));
+        if ((uint32_t)(num_sent) < region)
+        {   break;   }
+        region = port->tx_ring->read_region(&ptr);
+    }
+
+    return (port->tx_ring->available() > 0U);
+}
+
+/**
+ * @details This function writes the received data directly into the Tx FIFO
+ * of the bridged Port when nothing is waiting in its Tx queue (the lowest
+ * latency path). The data that doesn't fit in the FIFO is added to the
+ * bridged Port Tx queue (its overflow is counted as dropped there) and the
+ * bridged Port capture task is woken up to transmit it.
+ */
+void UARTCapture::forward(s_port* port, const uint8_t* data,
+        const uint32_t len)
+{
+    s_port* dst = port->bridge;
+
+    // Do nothing if the Port is not bridged to a running Port
+    if ( (dst == nullptr) || (dst->running == false) )
+    {   return;   }
+    UARTRingBuffer* tx_ring = dst->tx_ring;
+    if (tx_ring == nullptr)
+    {   return;   }
+
+    uint32_t num_sent = 0U;
+    if (tx_ring->available() == 0U)
+    {
+        int num_written = uart_tx_chars((uart_port_t)(dst->uart_n),
+            (const char*)(data), len);
+        if (num_written > 0)
+        {   num_sent = (uint32_t)(num_written);   }
+    }
+    if (num_sent >= len)
+    {   return;   }
+
+    tx_ring->write(&(data[num_sent]), len - num_sent);
+    uart_event_t wake_event = {};
+    wake_event.type = UART_EVENT_MAX;
+    xQueueSend(dst->event_queue, &wake_event, 0);
+}
+
+/*****************************************************************************/
@@ -0,0 +1,395 @@
+/**
+ * @file    uart_capture.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Event-Driven Capture Engine header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_CAPTURE_H
+#define UART_CAPTURE_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+// Arduino Framework
+#include <Arduino.h>
+
+// ESP-IDF UART Driver
+#include "driver/uart.h"
+
+// FreeRTOS
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+// Constant Data
+#include "constants.h"
+
+// UART Lock-Free Ring Buffer
+#include "uart_ring_buffer.h"
+
+// UART Rx Data Arrival Timestamps
+#include "uart_timestamps.h"
+
+// UART Line Events Queue
+#include "uart_line_events.h"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+class UARTCapture
+{
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Number of elements of the UART Driver events queue.
+         */
+        static constexpr int EVENT_QUEUE_LEN = 32;
+
+        /**
+         * @brief Time to retry moving data from the UART Driver to the Rx
+         * ring buffer while it was full.
+         */
+        static constexpr uint32_t T_RETRY_DRAIN_MS = 10U;
+
+        /**
+         * @brief Number of characters to let the UART Tx FIFO send before
+         * writing more data to it while the Tx queue is not empty (half of
+         * the hardware FIFO).
+         */
+        static constexpr uint32_t TX_RETRY_FIFO_CHARS = 64U;
+
+        /**
+         * @brief Size of the chunks read to discard UART Driver data when
+         * it can't be stored.
+         */
+        static constexpr uint32_t DISCARD_CHUNK_SIZE = 64U;
+
+        /**
+         * @brief Character to be detected in the Rx data stream to wake up
+         * the capture task as soon as a line is completed.
+         */
+        static constexpr char PATTERN_CHAR = '\n';
+
+        /**
+         * @brief Capture task stack size.
+         */
+        static constexpr uint32_t TASK_STACK_SIZE = 4096U;
+
+        /**
+         * @brief Capture task priority (above the Arduino loop task, so
+         * capture keeps going while loop() is blocked).
+         */
+        static constexpr UBaseType_t TASK_PRIORITY = 10U;
+
+        /**
+         * @brief CPU core where capture tasks are pinned.
+         */
+        static constexpr BaseType_t TASK_CORE = ARDUINO_RUNNING_CORE;
+
+        /**
+         * @brief Maximum time to wait for a capture task to finish when
+         * the capture of a Port is stopped.
+         */
+        static constexpr uint32_t T_TASK_STOP_TIMEOUT_MS = 500U;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+    private:
+
+        /**
+         * @brief Capture state of each UART Port.
+         */
+        struct s_port
+        {
+            // UART Port number
+            uint8_t uart_n;
+
+            // Capture task is running
+            volatile bool running;
+
+            // Capture task has been requested to finish
+            volatile bool stop_request;
+
+            // Capture task handle
+            TaskHandle_t task;
+
+            // UART Driver events queue
+            QueueHandle_t event_queue;
+
+            // Captured data ring buffer (capture task -> Interface)
+            UARTRingBuffer* ring;
+
+            // Captured data arrival time marks (optional)
+            UARTTimestamps* marks;
+
+            // Line events (errors, BREAK and data losses) queue (optional)
+            UARTLineEvents* events;
+
+            // Data to transmit queue (Interface -> capture task)
+            UARTRingBuffer* tx_ring;
+
+            // Time to wait for the Tx FIFO to make room for more data
+            TickType_t t_tx_retry;
+
+            // Number of UART Driver Rx FIFO overflow events
+            volatile uint32_t num_fifo_ovf;
+
+            // Number of UART Driver Rx ring buffer full events
+            volatile uint32_t num_buffer_full;
+
+            // Bridged Port where the received data is retransmitted
+            s_port* volatile bridge;
+
+            // Discard the received data when the Rx ring buffer is full
+            volatile bool discard;
+
+            // Capture paused (received data is kept in the UART Driver)
+            volatile bool paused;
+
+            // RTS hardware flow control enabled
+            bool rts_flow;
+        };
+
+    /******************************************************************/
+
+    /* Public Data Types */
+
+    public:
+
+        /**
+         * @brief UART Port line and capture settings.
+         */
+        struct s_line
+        {
+            // UART line configuration (speed, format and flow control)
+            uart_config_t config;
+
+            // Rx, Tx, RTS and CTS GPIOs (UART_PIN_NO_CHANGE: unused)
+            int rx_pin;
+            int tx_pin;
+            int rts_pin;
+            int cts_pin;
+
+            // ESP-IDF UART Driver Rx ring buffer size
+            int driver_rx_buffer_size;
+
+            // Rx FIFO full interrupt threshold (number of bytes)
+            uint8_t rx_full_thresh;
+        };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new UART Capture Engine object.
+         */
+        UARTCapture();
+
+        /**
+         * @brief Install the UART Driver of a Port and launch its capture
+         * task.
+         * @param uart_n UART Port number to start capturing.
+         * @param line UART line and capture settings.
+         * @param ring Ring buffer where captured data is written.
+         * @param marks Arrival time marks of the captured data (nullptr to
+         * not timestamp it).
+         * @param tx_ring Queue of data to transmit (nullptr for no Tx).
+         * @param events Queue of line events (nullptr to not report them).
+         * @return true Capture started.
+         * @return false Capture start fail.
+         */
+        bool start(const uint8_t uart_n, const s_line* line,
+                UARTRingBuffer* ring, UARTTimestamps* marks,
+                UARTRingBuffer* tx_ring, UARTLineEvents* events);
+
+        /**
+         * @brief Notify the capture task of a Port that new data has been
+         * queued to be transmitted.
+         * @param uart_n UART Port number.
+         */
+        void notify_tx(const uint8_t uart_n);
+
+        /**
+         * @brief Bridge an UART Port to another one, so all the data that
+         * it receives is retransmitted by the other Port from the capture
+         * task (bridges are one-way, set both Ports for a full bridge).
+         * @param uart_n UART Port number that receives the data.
+         * @param bridge_n UART Port number to retransmit it (an invalid
+         * Port number, i.e. the same one, to remove the bridge).
+         */
+        void set_bridge(const uint8_t uart_n, const uint8_t bridge_n);
+
+        /**
+         * @brief Set if the data received by a Port while its Rx ring
+         * buffer is full has to be discarded at once instead of being kept
+         * in the UART Driver.
+         * @param uart_n UART Port number.
+         * @param discard Discard the data.
+         */
+        void set_discard(const uint8_t uart_n, const bool discard);
+
+        /**
+         * @brief Pause or resume the capture of a Port. While paused, the
+         * received data is kept in the UART Driver (so the RTS flow control
+         * stops the sender when it gets full) or, if the Port has no RTS
+         * flow control, it is discarded.
+         * @param uart_n UART Port number.
+         * @param pause Pause the capture.
+         */
+        void set_pause(const uint8_t uart_n, const bool pause);
+
+        /**
+         * @brief Finish the capture task of a Port and uninstall its UART
+         * Driver.
+         * @param uart_n UART Port number to stop capturing.
+         */
+        void stop(const uint8_t uart_n);
+
+        /**
+         * @brief Check if an UART Port is being captured.
+         * @param uart_n UART Port number to check.
+         * @return true The Port is being captured.
+         * @return false The Port is not being captured.
+         */
+        bool is_running(const uint8_t uart_n);
+
+        /**
+         * @brief Get the number of Rx FIFO overflows of an UART Port.
+         * @param uart_n UART Port number to check.
+         * @return uint32_t Number of Rx FIFO overflows.
+         */
+        uint32_t get_num_fifo_ovf(const uint8_t uart_n);
+
+        /**
+         * @brief Get the number of UART Driver Rx buffer full events of an
+         * UART Port.
+         * @param uart_n UART Port number to check.
+         * @return uint32_t Number of UART Driver Rx buffer full events.
+         */
+        uint32_t get_num_buffer_full(const uint8_t uart_n);
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Capture task function, it waits for UART Driver events and
+         * move the received data to the Port Rx ring buffer.
+         * @param arg Pointer to the s_port capture state of the Port.
+         */
+        static void task_capture(void* arg);
+
+        /**
+         * @brief Move all the data buffered in the UART Driver of a Port
+         * to its Rx ring buffer.
+         * @param port Capture state of the Port.
+         * @return true Data is still pending in the UART Driver (the ring
+         * buffer is full).
+         * @return false The UART Driver has been drained.
+         */
+        static bool drain_driver(s_port* port);
+
+        /**
+         * @brief Discard all the data buffered in the UART Driver of a Port
+         * (accounting it as dropped in the Rx ring buffer).
+         * @param port Capture state of the Port.
+         * @return false Nothing is pending in the UART Driver.
+         */
+        static bool discard_driver(s_port* port);
+
+        /**
+         * @brief Report a line event of a Port at the current position of
+         * its captured data.
+         * @param port Capture state of the Port.
+         * @param type Line event type.
+         */
+        static void line_event(s_port* port,
+                const UARTLineEvents::t_event type);
+
+        /**
+         * @brief Move as much data as possible from the Tx queue of a Port
+         * to its UART Tx FIFO (without blocking).
+         * @param port Capture state of the Port.
+         * @return true Data is still pending in the Tx queue.
+         * @return false The Tx queue is empty.
+         */
+        static bool drain_tx(s_port* port);
+
+        /**
+         * @brief Retransmit received data through the bridged Port (if
+         * any) without blocking.
+         * @param port Capture state of the Port that received the data.
+         * @param data Received data.
+         * @param len Number of bytes received.
+         */
+        static void forward(s_port* port, const uint8_t* data,
+                const uint32_t len);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Capture state of each UART Port.
+         */
+        s_port ports[ns_const::MAX_NUM_UART];
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_CAPTURE_H */
@@ -0,0 +1,286 @@
+/**
+ * @file    uart_compressor.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx stream LZSS compressor (heatshrink-class) source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_compressor.h"
+
+// C++ Standard Libraries
+#include <cstring>
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes the compressor with an
+ * empty window.
+ */
+UARTCompressor::UARTCompressor()
+{
+    pos = 0U;
+    base = 0U;
+    bits_out = nullptr;
+    bits_size = 0U;
+    bits_len = 0U;
+    bits_acc = 0U;
+    bits_count = 0U;
+    bits_overflow = false;
+    num_in = 0U;
+    num_out = 0U;
+    memset((void*)(window), 0, sizeof(window));
+    memset((void*)(chain_head), 0, sizeof(chain_head));
+    memset((void*)(chain_prev), 0, sizeof(chain_prev));
+    reset();
+}
+
+/**
+ * @details This function empties the window, so no back-reference of the
+ * next message reaches previous data.
+ */
+void UARTCompressor::reset()
+{
+    window_len = 0U;
+    num_msgs = 0U;
+}
+
+/**
+ * @details This function encodes the message with greedy matching: at each
+ * position, the hash chain of its first bytes gives the previous positions
+ * to check (the nearest ones first), and the longest match is written as a
+ * back-reference if it reaches the minimum length (a literal otherwise).
+ * All the message bytes are added to the window even if the output doesn't
+ * fit, so the message is stored as is in that case without losing the
+ * window sync with the decoder.
+ */
+uint32_t UARTCompressor::compress(const uint8_t* data, const uint32_t len,
+        uint8_t* out, const uint32_t out_size)
+{
+    // The message would be lost, so the next one can't depend on it
+    if (HEADER_SIZE + len > out_size)
+    {
+        reset();
+        return 0U;
+    }
+
+    if (num_msgs >= RESET_INTERVAL)
+    {   reset();   }
+    uint8_t header = (window_len == 0U) ? FLAG_RESET : 0U;
+    num_msgs = num_msgs + 1U;
+
+    // The compressed data must be shorter than the stored one
+    bits_out = &(out[HEADER_SIZE]);
+    bits_size = len;
+    bits_len = 0U;
+    bits_acc = 0U;
+    bits_count = 0U;
+    bits_overflow = false;
+
+    base = pos;
+    uint32_t i = 0U;
+    while (i < len)
+    {
+        uint32_t best_len = 0U;
+        uint32_t best_dist = 0U;
+        uint32_t max_len = len - i;
+        if (max_len > MAX_MATCH)
+        {   max_len = MAX_MATCH;   }
+
+        if (max_len >= MIN_MATCH)
+        {
+            uint16_t head = chain_head[hash(&(data[i]))];
+            uint32_t cand = pos - (uint16_t)(pos - head);
+            for (uint8_t n = 0U; n < MAX_CHAIN; n++)
+            {
+                uint32_t dist = pos - cand;
+                if ( (dist == 0U) || (dist > WINDOW_SIZE) ||
+                     (dist > window_len) )
+                {   break;   }
+
+                uint32_t match_len = 0U;
+                while ( (match_len < max_len) &&
+                        (byte_at(cand + match_len, data) ==
+                            data[i + match_len]) )
+                {   match_len = match_len + 1U;   }
+                if (match_len > best_len)
+                {
+                    best_len = match_len;
+                    best_dist = dist;
+                    if (best_len == max_len)
+                    {   break;   }
+                }
+
+                uint32_t prev = cand -
+                    (uint16_t)(cand - chain_prev[cand & (WINDOW_SIZE - 1U)]);
+                if (prev == cand)
+                {   break;   }
+                cand = prev;
+            }
+        }
+
+        uint32_t token_len = 1U;
+        if (best_len >= MIN_MATCH)
+        {
+            put_bits(0U, 1U);
+            put_bits(best_dist - 1U, WINDOW_BITS);
+            put_bits(best_len - MIN_MATCH, LENGTH_BITS);
+            token_len = best_len;
+        }
+        else
+        {
+            put_bits(1U, 1U);
+            put_bits(data[i], 8U);
+        }
+
+        // Add the bytes to the window and their positions to the chains
+        for (uint32_t j = 0U; j < token_len; j++)
+        {
+            if (i + MIN_MATCH <= len)
+            {   insert(i, data);   }
+            window[pos & (WINDOW_SIZE - 1U)] = data[i];
+            pos = pos + 1U;
+            i = i + 1U;
+            if (window_len < WINDOW_SIZE)
+            {   window_len = window_len + 1U;   }
+        }
+    }
+
+    // Flush the last bits (0 padded)
+    if (bits_count > 0U)
+    {   put_bits(0U, 8U - bits_count);   }
+
+    uint32_t size = 0U;
+    if ( bits_overflow || (bits_len >= len) )
+    {
+        out[0] = header | FLAG_STORED;
+        memcpy(&(out[HEADER_SIZE]), data, len);
+        size = HEADER_SIZE + len;
+    }
+    else
+    {
+        out[0] = header;
+        size = HEADER_SIZE + bits_len;
+    }
+
+    num_in = num_in + len;
+    num_out = num_out + size;
+    return size;
+}
+
+/**
+ * @details Getter method to return the number of bytes compressed.
+ */
+uint32_t UARTCompressor::get_num_in()
+{
+    return num_in;
+}
+
+/**
+ * @details Getter method to return the number of compressed bytes.
+ */
+uint32_t UARTCompressor::get_num_out()
+{
+    return num_out;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details The bytes before the message are taken from the window (the
+ * distance of the candidates is limited to the window size, so they have
+ * not been overwritten yet). Matches never go further than MAX_MATCH bytes
+ * after the current position.
+ */
+uint8_t UARTCompressor::byte_at(const uint32_t abs_pos, const uint8_t* data)
+{
+    if ((uint32_t)(abs_pos - base) < (uint32_t)(pos - base + MAX_MATCH))
+    {   return data[abs_pos - base];   }
+
+    return window[abs_pos & (WINDOW_SIZE - 1U)];
+}
+
+/**
+ * @details This function mixes the first two bytes of the position.
+ */
+uint16_t UARTCompressor::hash(const uint8_t* data)
+{
+    return (uint16_t)(((uint32_t)(data[0]) * 31U + data[1]) &
+        (HASH_SIZE - 1U));
+}
+
+/**
+ * @details This function links the stream position to the previous one with
+ * the same hash and makes it the head of the chain. Links to positions out
+ * of the window (or before it was emptied) are detected by their distance.
+ */
+void UARTCompressor::insert(const uint32_t i, const uint8_t* data)
+{
+    uint16_t h = hash(&(data[i]));
+    uint32_t abs_pos = base + i;
+
+    chain_prev[abs_pos & (WINDOW_SIZE - 1U)] = chain_head[h];
+    chain_head[h] = (uint16_t)(abs_pos);
+}
+
+/**
+ * @details This function accumulates the bits and writes each complete byte
+ * to the output buffer (most significant bit first), flagging the overflow
+ * when the buffer is full.
+ */
+void UARTCompressor::put_bits(const uint32_t value, const uint8_t num_bits)
+{
+    for (int8_t b = (int8_t)(num_bits) - 1; b >= 0; b--)
+    {
+        bits_acc = (bits_acc << 1) | ((value >> b) & 1U);
+        bits_count = bits_count + 1U;
+        if (bits_count < 8U)
+        {   continue;   }
+
+        if (bits_len < bits_size)
+        {   bits_out[bits_len] = (uint8_t)(bits_acc & 0xFFU);   }
+        else
+        {   bits_overflow = true;   }
+        bits_len = bits_len + 1U;
+        bits_acc = 0U;
+        bits_count = 0U;
+    }
+}
+
+/*****************************************************************************/
@@ -0,0 +1,285 @@
+/**
+ * @file    uart_compressor.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx stream LZSS compressor (heatshrink-class) header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_COMPRESSOR_H
+#define UART_COMPRESSOR_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief Streaming LZSS compressor of UART Rx messages with a fixed size
+ * window (no heap memory). The window keeps the data of the previous
+ * messages, so repetitions across messages are compressed too, and each
+ * message is compressed to a byte aligned bitstream that starts with a
+ * header byte. The bitstream is a sequence of tokens (most significant bit
+ * first):
+ * - Literal: A 1 bit followed by the byte (8 bits).
+ * - Back-reference: A 0 bit followed by the distance minus 1 (WINDOW_BITS
+ *   bits) and the length minus MIN_MATCH (LENGTH_BITS bits) of a copy of
+ *   previous data (that can overlap the data being copied).
+ * The last byte is padded with 0 bits (less than a token).
+ */
+class UARTCompressor
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+    public:
+
+        /**
+         * @brief Window size bits (back-reference distance field).
+         */
+        static constexpr uint8_t WINDOW_BITS = 10U;
+
+        /**
+         * @brief Back-reference length field bits.
+         */
+        static constexpr uint8_t LENGTH_BITS = 5U;
+
+        /**
+         * @brief Minimum back-reference length.
+         */
+        static constexpr uint32_t MIN_MATCH = 2U;
+
+        /**
+         * @brief Message header size.
+         */
+        static constexpr uint32_t HEADER_SIZE = 1U;
+
+        /**
+         * @brief Message header flag: The window is empty (the message
+         * doesn't depend on previous ones).
+         */
+        static constexpr uint8_t FLAG_RESET = 0x01U;
+
+        /**
+         * @brief Message header flag: The message data is stored as is (it
+         * is still added to the window).
+         */
+        static constexpr uint8_t FLAG_STORED = 0x02U;
+
+        /**
+         * @brief Number of messages after which the window is emptied, so
+         * new subscribers can start decoding.
+         */
+        static constexpr uint32_t RESET_INTERVAL = 64U;
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Window size.
+         */
+        static constexpr uint32_t WINDOW_SIZE = (1UL << WINDOW_BITS);
+
+        /**
+         * @brief Maximum back-reference length.
+         */
+        static constexpr uint32_t MAX_MATCH =
+            MIN_MATCH + (1UL << LENGTH_BITS) - 1U;
+
+        /**
+         * @brief Number of hash chains heads.
+         */
+        static constexpr uint32_t HASH_SIZE = 512U;
+
+        /**
+         * @brief Maximum number of candidates checked for a match.
+         */
+        static constexpr uint8_t MAX_CHAIN = 16U;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new Compressor object (with an empty window).
+         */
+        UARTCompressor();
+
+        /**
+         * @brief Empty the window (the next message is flagged as reset).
+         */
+        void reset();
+
+        /**
+         * @brief Compress a message (adding it to the window).
+         * @param data Message data.
+         * @param len Message length.
+         * @param out Compressed message buffer.
+         * @param out_size Compressed message buffer size (the message is
+         * stored as is if it doesn't compress below its length).
+         * @return uint32_t Compressed message length with its header (0 if
+         * the buffer is smaller than the stored message, then the window
+         * is emptied).
+         */
+        uint32_t compress(const uint8_t* data, const uint32_t len,
+                uint8_t* out, const uint32_t out_size);
+
+        /**
+         * @brief Get the number of bytes compressed.
+         * @return uint32_t Number of bytes.
+         */
+        uint32_t get_num_in();
+
+        /**
+         * @brief Get the number of compressed bytes (headers included).
+         * @return uint32_t Number of bytes.
+         */
+        uint32_t get_num_out();
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Get a byte of the stream (from the window or from the
+         * message being compressed).
+         * @param abs_pos Stream position of the byte.
+         * @param data Message data.
+         * @return uint8_t Byte.
+         */
+        uint8_t byte_at(const uint32_t abs_pos, const uint8_t* data);
+
+        /**
+         * @brief Get the hash of the first MIN_MATCH bytes at a message
+         * position.
+         * @param data Message data.
+         * @return uint16_t Hash.
+         */
+        static uint16_t hash(const uint8_t* data);
+
+        /**
+         * @brief Add a message position to its hash chain.
+         * @param i Message position.
+         * @param data Message data.
+         */
+        void insert(const uint32_t i, const uint8_t* data);
+
+        /**
+         * @brief Append bits to the output bitstream.
+         * @param value Bits value.
+         * @param num_bits Number of bits.
+         */
+        void put_bits(const uint32_t value, const uint8_t num_bits);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Window (the last WINDOW_SIZE bytes of the stream).
+         */
+        uint8_t window[WINDOW_SIZE];
+
+        /**
+         * @brief Hash chains heads and links (16 bits stream positions,
+         * candidates are verified comparing the data).
+         */
+        uint16_t chain_head[HASH_SIZE];
+        uint16_t chain_prev[WINDOW_SIZE];
+
+        /**
+         * @brief Stream position of the next byte.
+         */
+        uint32_t pos;
+
+        /**
+         * @brief Stream position of the message being compressed.
+         */
+        uint32_t base;
+
+        /**
+         * @brief Number of bytes in the window.
+         */
+        uint32_t window_len;
+
+        /**
+         * @brief Number of messages since the window was emptied.
+         */
+        uint32_t num_msgs;
+
+        /**
+         * @brief Output bitstream buffer, size, length, pending bits and
+         * overflow flag.
+         */
+        uint8_t* bits_out;
+        uint32_t bits_size;
+        uint32_t bits_len;
+        uint32_t bits_acc;
+        uint8_t bits_count;
+        bool bits_overflow;
+
+        /**
+         * @brief Number of bytes compressed.
+         */
+        uint32_t num_in;
+
+        /**
+         * @brief Number of compressed bytes.
+         */
+        uint32_t num_out;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_COMPRESSOR_H */
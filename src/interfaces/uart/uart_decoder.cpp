@@ -0,0 +1,137 @@
+/**
+ * @file    uart_decoder.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART protocol decoders framework source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_decoder.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes the decoder without sink
+ * and with the counters cleared.
+ */
+UARTDecoder::UARTDecoder()
+{
+    char_time_us = 0U;
+    num_errors = 0U;
+    sink = nullptr;
+    sink_ctx = nullptr;
+    num_records = 0U;
+}
+
+/**
+ * @details The destructor is virtual, so the decoders are destroyed through
+ * the interface when a Port changes its decoder.
+ */
+UARTDecoder::~UARTDecoder()
+{}
+
+/**
+ * @details Setter method to configure the records sink.
+ */
+void UARTDecoder::set_sink(t_sink sink, void* ctx)
+{
+    this->sink = sink;
+    sink_ctx = ctx;
+}
+
+/**
+ * @details Setter method to configure the UART Port character time.
+ */
+void UARTDecoder::set_char_time(const uint32_t char_time_us)
+{
+    this->char_time_us = char_time_us;
+}
+
+/**
+ * @details Getter method to return the number of emitted records.
+ */
+uint32_t UARTDecoder::get_num_records()
+{
+    return num_records;
+}
+
+/**
+ * @details Getter method to return the number of frames that could not be
+ * decoded.
+ */
+uint32_t UARTDecoder::get_num_errors()
+{
+    return num_errors;
+}
+
+/**
+ * @details By default the decoders use the time when each frame is fed.
+ */
+bool UARTDecoder::needs_timestamps()
+{
+    return false;
+}
+
+/**
+ * @details By default the decoders replace the Rx frames with their
+ * records.
+ */
+bool UARTDecoder::pass_raw()
+{
+    return false;
+}
+
+/*****************************************************************************/
+
+/* Protected Methods */
+
+/**
+ * @details The record is counted even if the publish fails (it was decoded).
+ */
+bool UARTDecoder::emit(const char* subtopic, const uint8_t* record,
+        const uint32_t len)
+{
+    num_records = num_records + 1U;
+
+    if (sink == nullptr)
+    {   return false;   }
+
+    return sink(sink_ctx, subtopic, record, len);
+}
+
+/*****************************************************************************/
@@ -0,0 +1,409 @@
+/**
+ * @file    uart_decoder.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART protocol decoders framework header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_DECODER_H
+#define UART_DECODER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief Protocol decoder plug-in interface. A decoder is fed with the Rx
+ * frames of an UART Port (split with the framing that it requires) and
+ * emits its records through the sink of the Port, which publishes them on
+ * the decoder topic of the Port ("/uart/N/<name>", or a subtopic of it).
+ * Decoders are periodically flushed to complete the records that depend on
+ * time (i.e. timeouts). Each decoder class must provide a NAME constant and
+ * a default constructor to be registered in a UARTDecoderRegistry.
+ */
+class UARTDecoder
+{
+    /******************************************************************/
+
+    /* Public Data Types */
+
+    public:
+
+        /**
+         * @brief Rx framing required by a decoder.
+         */
+        enum class t_framing : uint8_t
+        {
+            // Frames end with a delimiter character (parameter)
+            LINE = 0,
+
+            // Frames end after an inter-byte silence (parameter, number of
+            // character times)
+            IDLE = 1
+        };
+
+        /**
+         * @brief Records sink (called for each emitted record).
+         * @param ctx Sink context.
+         * @param subtopic Subtopic of the decoder topic (nullptr for the
+         * decoder topic itself).
+         * @param record Record data.
+         * @param len Record length.
+         * @return true Record published.
+         * @return false Publish fail.
+         */
+        typedef bool (*t_sink)(void* ctx, const char* subtopic,
+                const uint8_t* record, const uint32_t len);
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new decoder object.
+         */
+        UARTDecoder();
+
+        /**
+         * @brief Destroy the decoder object.
+         */
+        virtual ~UARTDecoder();
+
+        /**
+         * @brief Set the sink of the emitted records.
+         * @param sink Sink function.
+         * @param ctx Sink context.
+         */
+        void set_sink(t_sink sink, void* ctx);
+
+        /**
+         * @brief Set the character time of the UART Port (called before
+         * each feed and flush).
+         * @param char_time_us Character time (us).
+         */
+        void set_char_time(const uint32_t char_time_us);
+
+        /**
+         * @brief Get the number of emitted records.
+         * @return uint32_t Number of records.
+         */
+        uint32_t get_num_records();
+
+        /**
+         * @brief Get the number of frames that could not be decoded.
+         * @return uint32_t Number of errors.
+         */
+        uint32_t get_num_errors();
+
+        /**
+         * @brief Configure the decoder options.
+         * @param argc Number of option arguments.
+         * @param argv Option arguments.
+         * @return true Configuration success.
+         * @return false Unknown or invalid option.
+         */
+        virtual bool configure(int argc, char* argv[]) = 0;
+
+        /**
+         * @brief Get the Rx framing required by the decoder.
+         * @param framing Framing mode.
+         * @param param Framing mode parameter.
+         */
+        virtual void get_framing(t_framing* framing, uint32_t* param) = 0;
+
+        /**
+         * @brief Check if the decoder requires the Rx frames timestamps
+         * (arrival time of the first byte instead of the feed time).
+         * @return true Timestamps required.
+         * @return false Timestamps not required.
+         */
+        virtual bool needs_timestamps();
+
+        /**
+         * @brief Check if the Rx frames must be published raw too.
+         * @return true Publish the frames.
+         * @return false Only the records are published.
+         */
+        virtual bool pass_raw();
+
+        /**
+         * @brief Feed a Rx frame to the decoder.
+         * @param data Frame data.
+         * @param len Frame length.
+         * @param t_us Frame first byte arrival time (us).
+         */
+        virtual void feed(const uint8_t* data, const uint32_t len,
+                const int64_t t_us) = 0;
+
+        /**
+         * @brief Complete the records whose time has elapsed.
+         * @param t_now_us Current time (us, INT64_MAX to complete all the
+         * pending records).
+         */
+        virtual void flush(const int64_t t_now_us) = 0;
+
+    /******************************************************************/
+
+    /* Protected Methods */
+
+    protected:
+
+        /**
+         * @brief Emit a record through the sink.
+         * @param subtopic Subtopic of the decoder topic (nullptr for the
+         * decoder topic itself).
+         * @param record Record data.
+         * @param len Record length.
+         * @return true Record published.
+         * @return false No sink or publish fail.
+         */
+        bool emit(const char* subtopic, const uint8_t* record,
+                const uint32_t len);
+
+    /******************************************************************/
+
+    /* Protected Attributes */
+
+    protected:
+
+        /**
+         * @brief Character time of the UART Port (us).
+         */
+        uint32_t char_time_us;
+
+        /**
+         * @brief Number of frames that could not be decoded.
+         */
+        uint32_t num_errors;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Records sink and its context.
+         */
+        t_sink sink;
+        void* sink_ctx;
+
+        /**
+         * @brief Number of emitted records.
+         */
+        uint32_t num_records;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Registry Entries */
+
+/**
+ * @brief Entry of a decoder in a UARTDecoderRegistry. A disabled entry keeps
+ * its ID but takes no storage, and the decoder code is not referenced (so it
+ * is discarded by the linker).
+ * @tparam ENABLED The decoder is included in the firmware.
+ * @tparam T Decoder class.
+ */
+template <bool ENABLED, typename T>
+struct UARTDecoderEntry
+{
+    /**
+     * @brief Decoder name (nullptr if disabled).
+     */
+    static constexpr const char* NAME = (ENABLED) ? T::NAME : nullptr;
+
+    /**
+     * @brief Storage size and alignment of the decoder.
+     */
+    static constexpr size_t SIZE = (ENABLED) ? sizeof(T) : 0U;
+    static constexpr size_t ALIGN = (ENABLED) ? alignof(T) : 1U;
+
+    /**
+     * @brief Construct the decoder in a storage.
+     * @param storage Storage (SIZE bytes, ALIGN aligned).
+     * @return UARTDecoder* Decoder (nullptr if disabled).
+     */
+    static UARTDecoder* create(void* storage)
+    {
+        if constexpr (ENABLED)
+        {   return new (storage) T();   }
+        else
+        {
+            (void)(storage);
+            return nullptr;
+        }
+    }
+};
+
+/*****************************************************************************/
+
+/* Registry Helpers */
+
+/**
+ * @brief Get the maximum of a list of sizes (at least 1, so an empty
+ * registry still has a valid storage).
+ * @param sizes Sizes.
+ * @return size_t Maximum size.
+ */
+template <typename... Sizes>
+constexpr size_t uart_decoder_max_of(const Sizes... sizes)
+{
+    size_t result = 1U;
+    ((result = (sizes > result) ? sizes : result), ...);
+    return result;
+}
+
+/*****************************************************************************/
+
+/* Registry Interface */
+
+/**
+ * @brief Compile-time registry of decoders. The decoders are identified by
+ * their position in the list (from 1, 0 means no decoder), and each UART
+ * Port holds a single decoder at a time in a storage of the size of the
+ * biggest registered one.
+ * @tparam Entries UARTDecoderEntry of each decoder.
+ */
+template <typename... Entries>
+class UARTDecoderRegistry
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+    public:
+
+        /**
+         * @brief Number of registry entries.
+         */
+        static constexpr uint8_t NUM_ENTRIES = sizeof...(Entries);
+
+        /**
+         * @brief Storage size required by the biggest decoder.
+         */
+        static constexpr size_t STORAGE_SIZE =
+            uart_decoder_max_of(Entries::SIZE...);
+
+        /**
+         * @brief Storage alignment required by the decoders.
+         */
+        static constexpr size_t STORAGE_ALIGN =
+            uart_decoder_max_of(Entries::ALIGN...);
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Find a decoder by its name.
+         * @param name Decoder name.
+         * @return uint8_t Decoder ID (0 if not found or disabled).
+         */
+        static uint8_t find(const char* name)
+        {
+            for (uint8_t i = 0U; i < NUM_ENTRIES; i++)
+            {
+                if ( (NAMES[i] != nullptr) && (strcmp(NAMES[i], name) == 0) )
+                {   return i + 1U;   }
+            }
+            return 0U;
+        }
+
+        /**
+         * @brief Get the name of a decoder.
+         * @param id Decoder ID.
+         * @return const char* Decoder name (nullptr if invalid).
+         */
+        static const char* get_name(const uint8_t id)
+        {
+            if ( (id == 0U) || (id > NUM_ENTRIES) )
+            {   return nullptr;   }
+            return NAMES[id - 1U];
+        }
+
+        /**
+         * @brief Construct a decoder in a storage.
+         * @param id Decoder ID.
+         * @param storage Storage (STORAGE_SIZE bytes, STORAGE_ALIGN aligned).
+         * @return UARTDecoder* Decoder (nullptr if invalid or disabled).
+         */
+        static UARTDecoder* create(const uint8_t id, void* storage)
+        {
+            if ( (id == 0U) || (id > NUM_ENTRIES) )
+            {   return nullptr;   }
+            return FACTORIES[id - 1U](storage);
+        }
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Decoders names and constructors (one more element, so the
+         * arrays are never empty).
+         */
+        static constexpr const char* NAMES[NUM_ENTRIES + 1U] =
+            { Entries::NAME..., nullptr };
+        static constexpr UARTDecoder* (*FACTORIES[NUM_ENTRIES + 1U])(void*) =
+            { &(Entries::create)..., nullptr };
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_DECODER_H */
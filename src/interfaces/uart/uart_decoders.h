@@ -0,0 +1,78 @@
+/**
+ * @file    uart_decoders.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Protocol Decoders Registry header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_DECODERS_H
+#define UART_DECODERS_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Configuration Data
+#include "config.h"
+
+// UART Protocol Decoders Framework
+#include "uart_decoder.h"
+
+// UART Modbus RTU Sniffer Decoder
+#include "uart_modbus.h"
+
+// UART NMEA 0183 Decoder
+#include "uart_nmea.h"
+
+/*****************************************************************************/
+
+/* Decoders Registry */
+
+/**
+ * @brief Protocol decoders available for the UART Ports. The decoders IDs
+ * (stored in the Port configuration) are their position in this list, so
+ * new decoders must be added at the end. Decoders disabled by the build
+ * flags keep their ID but take no Firmware or RAM space.
+ */
+using UARTDecoders = UARTDecoderRegistry<
+    UARTDecoderEntry<ns_const::UART_DECODER_MODBUS, UARTModbus>,
+    UARTDecoderEntry<ns_const::UART_DECODER_NMEA, UARTNmea>
+>;
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_DECODERS_H */
@@ -0,0 +1,359 @@
+/**
+ * @file    uart_filter.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx frames multi-pattern filter (Aho-Corasick) source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_filter.h"
+
+// C++ Standard Libraries
+#include <cstring>
+
+// ESP-IDF Heap Memory Allocation
+#include "esp_heap_caps.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes an empty filter (without
+ * tables).
+ */
+UARTFilter::UARTFilter()
+{
+    tables = nullptr;
+    patterns = nullptr;
+    states = nullptr;
+    num_matched = 0U;
+    num_dropped = 0U;
+    clear();
+}
+
+/**
+ * @details This function allocates the filter tables for the first pattern
+ * (from PSRAM on boards that have it), strips the anchors of the pattern
+ * string, stores it and rebuilds the automaton (the pattern is removed if the
+ * automaton has no room for it).
+ */
+bool UARTFilter::add(const t_rule rule, const char* pattern,
+        const uint32_t len)
+{
+    // Do nothing if there is no pattern or no room for it
+    if ( (pattern == nullptr) || (num_patterns >= MAX_PATTERNS) )
+    {   return false;   }
+
+    if (tables == nullptr)
+    {
+        #if defined(BOARD_HAS_PSRAM)
+            tables = (s_tables*)(heap_caps_malloc(sizeof(s_tables),
+                MALLOC_CAP_SPIRAM));
+        #else
+            tables = (s_tables*)(heap_caps_malloc(sizeof(s_tables),
+                MALLOC_CAP_8BIT));
+        #endif
+        if (tables == nullptr)
+        {   return false;   }
+        patterns = tables->patterns;
+        states = tables->states;
+    }
+
+    s_pattern* new_pattern = &(patterns[num_patterns]);
+    const char* data = pattern;
+    uint32_t data_len = len;
+    new_pattern->anchor_start = false;
+    new_pattern->anchor_end = false;
+    if ( (data_len > 0U) && (data[0] == '^') )
+    {
+        new_pattern->anchor_start = true;
+        data = &(data[1]);
+        data_len = data_len - 1U;
+    }
+    if ( (data_len > 0U) && (data[data_len - 1U] == '$') )
+    {
+        new_pattern->anchor_end = true;
+        data_len = data_len - 1U;
+    }
+
+    // Do nothing if the pattern is empty or too long
+    if ( (data_len == 0U) || (data_len > MAX_PATTERN_LEN) )
+    {
+        if (num_patterns == 0U)
+        {   clear();   }
+        return false;
+    }
+
+    memcpy((void*)(new_pattern->data), (const void*)(data), data_len);
+    new_pattern->len = (uint8_t)(data_len);
+    new_pattern->rule = rule;
+    num_patterns = num_patterns + 1U;
+    if (build() == false)
+    {
+        num_patterns = num_patterns - 1U;
+        if (num_patterns == 0U)
+        {   clear();   }
+        else
+        {   build();   }
+        return false;
+    }
+
+    uint16_t bit = (uint16_t)(1U << (num_patterns - 1U));
+    if (rule == t_rule::INCLUDE)
+    {   include_mask = include_mask | bit;   }
+    else
+    {   exclude_mask = exclude_mask | bit;   }
+
+    return true;
+}
+
+/**
+ * @details This function removes all the patterns and releases the filter
+ * tables (there is no automaton until a pattern is added).
+ */
+void UARTFilter::clear()
+{
+    num_patterns = 0U;
+    include_mask = 0U;
+    exclude_mask = 0U;
+    num_states = 0U;
+    if (tables != nullptr)
+    {
+        heap_caps_free(tables);
+        tables = nullptr;
+        patterns = nullptr;
+        states = nullptr;
+    }
+}
+
+/**
+ * @details This function gets the patterns matched by the frame and applies
+ * the rules: the frame is dropped if it matches an exclude pattern, or if
+ * there are include patterns and it doesn't match any of them.
+ */
+bool UARTFilter::pass(const uint8_t* data, const uint32_t len)
+{
+    // Every frame passes if there are no patterns
+    if (num_patterns == 0U)
+    {   return true;   }
+
+    uint16_t matched = match(data, len);
+    if (matched != 0U)
+    {   num_matched = num_matched + 1U;   }
+
+    if ( ((matched & exclude_mask) != 0U) ||
+         ((include_mask != 0U) && ((matched & include_mask) == 0U)) )
+    {
+        num_dropped = num_dropped + 1U;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @details Getter method to return the number of patterns.
+ */
+uint8_t UARTFilter::get_num_patterns()
+{
+    return num_patterns;
+}
+
+/**
+ * @details Getter method to return the number of matched frames.
+ */
+uint32_t UARTFilter::get_num_matched()
+{
+    return num_matched;
+}
+
+/**
+ * @details Getter method to return the number of dropped frames.
+ */
+uint32_t UARTFilter::get_num_dropped()
+{
+    return num_dropped;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details This function builds the trie of the unanchored patterns, marking
+ * the state where each one ends, then computes the failure links in breadth
+ * first order (so the link of a state always points to an already processed
+ * shallower state) and merges the matched patterns of the failure link into
+ * each state, so the matching only needs to check the current state.
+ */
+bool UARTFilter::build()
+{
+    states[0].first_child = NO_STATE;
+    states[0].next_sibling = NO_STATE;
+    states[0].fail = 0U;
+    states[0].ch = 0U;
+    states[0].out = 0U;
+    num_states = 1U;
+
+    // Build the trie
+    for (uint8_t i = 0U; i < num_patterns; i++)
+    {
+        if (patterns[i].anchor_start || patterns[i].anchor_end)
+        {   continue;   }
+
+        uint16_t state = 0U;
+        for (uint8_t ii = 0U; ii < patterns[i].len; ii++)
+        {
+            uint8_t ch = patterns[i].data[ii];
+            uint16_t next = child(state, ch);
+            if (next == NO_STATE)
+            {
+                if (num_states >= MAX_STATES)
+                {   return false;   }
+                next = num_states;
+                num_states = num_states + 1U;
+                states[next].first_child = NO_STATE;
+                states[next].next_sibling = states[state].first_child;
+                states[next].fail = 0U;
+                states[next].ch = ch;
+                states[next].out = 0U;
+                states[state].first_child = next;
+            }
+            state = next;
+        }
+        states[state].out = states[state].out | (uint16_t)(1U << i);
+    }
+
+    // Compute the failure links (breadth first)
+    uint16_t queue[MAX_STATES];
+    uint16_t head = 0U;
+    uint16_t tail = 0U;
+    for (uint16_t s = states[0].first_child; s != NO_STATE;
+            s = states[s].next_sibling)
+    {
+        states[s].fail = 0U;
+        queue[tail] = s;
+        tail = tail + 1U;
+    }
+    while (head < tail)
+    {
+        uint16_t state = queue[head];
+        head = head + 1U;
+        for (uint16_t s = states[state].first_child; s != NO_STATE;
+                s = states[s].next_sibling)
+        {
+            uint16_t fail = states[state].fail;
+            uint16_t next = child(fail, states[s].ch);
+            while ( (next == NO_STATE) && (fail != 0U) )
+            {
+                fail = states[fail].fail;
+                next = child(fail, states[s].ch);
+            }
+            states[s].fail = (next == NO_STATE) ? 0U : next;
+            states[s].out = states[s].out | states[states[s].fail].out;
+            queue[tail] = s;
+            tail = tail + 1U;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @details This function looks for the child of the state through the
+ * character in the state children list.
+ */
+uint16_t UARTFilter::child(const uint16_t state, const uint8_t ch)
+{
+    for (uint16_t s = states[state].first_child; s != NO_STATE;
+            s = states[s].next_sibling)
+    {
+        if (states[s].ch == ch)
+        {   return s;   }
+    }
+
+    return NO_STATE;
+}
+
+/**
+ * @details This function runs the automaton over the frame in a single pass,
+ * following the failure links when there is no transition for a character,
+ * and collects the patterns matched in each state. The anchored patterns are
+ * compared directly against the frame start and/or end.
+ */
+uint16_t UARTFilter::match(const uint8_t* data, const uint32_t len)
+{
+    uint16_t matched = 0U;
+
+    // Unanchored patterns
+    uint16_t state = 0U;
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        uint16_t next = child(state, data[i]);
+        while ( (next == NO_STATE) && (state != 0U) )
+        {
+            state = states[state].fail;
+            next = child(state, data[i]);
+        }
+        state = (next == NO_STATE) ? 0U : next;
+        matched = matched | states[state].out;
+    }
+
+    // Anchored patterns
+    for (uint8_t i = 0U; i < num_patterns; i++)
+    {
+        s_pattern* pattern = &(patterns[i]);
+        if ( (pattern->anchor_start == false) &&
+             (pattern->anchor_end == false) )
+        {   continue;   }
+        if (pattern->len > len)
+        {   continue;   }
+        if ( pattern->anchor_start && pattern->anchor_end &&
+             (pattern->len != len) )
+        {   continue;   }
+
+        const uint8_t* ptr = data;
+        if (pattern->anchor_start == false)
+        {   ptr = &(data[len - pattern->len]);   }
+        if (memcmp((const void*)(ptr), (const void*)(pattern->data),
+                pattern->len) == 0)
+        {   matched = matched | (uint16_t)(1U << i);   }
+    }
+
+    return matched;
+}
+
+/*****************************************************************************/
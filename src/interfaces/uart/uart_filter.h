@@ -0,0 +1,317 @@
+/**
+ * @file    uart_filter.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx frames multi-pattern filter (Aho-Corasick) header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_FILTER_H
+#define UART_FILTER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief Multi-pattern filter of UART Rx frames. Include and exclude
+ * substrings are compiled into an Aho-Corasick automaton, so all of them are
+ * searched in a single pass over each frame. Patterns can also be anchored to
+ * the frame start ("^pattern"), end ("pattern$") or both ("^pattern$"),
+ * which are checked directly. A frame passes the filter if it matches any
+ * include pattern (or there are none) and doesn't match any exclude pattern.
+ * The patterns and automaton tables are only allocated while the filter has
+ * patterns.
+ */
+class UARTFilter
+{
+    /******************************************************************/
+
+    /* Public Data Types */
+
+    public:
+
+        /**
+         * @brief Pattern filter rule.
+         */
+        enum class t_rule : uint8_t
+        {
+            INCLUDE = 0U,
+            EXCLUDE = 1U
+        };
+
+    /******************************************************************/
+
+    /* Public Constants */
+
+    public:
+
+        /**
+         * @brief Maximum number of patterns.
+         */
+        static constexpr uint8_t MAX_PATTERNS = 16U;
+
+        /**
+         * @brief Maximum length of a pattern (anchors not included).
+         */
+        static constexpr uint8_t MAX_PATTERN_LEN = 32U;
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Maximum number of automaton states (the root plus one per
+         * character of the unanchored patterns, at most).
+         */
+        static constexpr uint16_t MAX_STATES = 256U;
+
+        /**
+         * @brief No automaton state (end of children list).
+         */
+        static constexpr uint16_t NO_STATE = 0xFFFFU;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+    private:
+
+        /**
+         * @brief Filter pattern.
+         */
+        struct s_pattern
+        {
+            // Pattern characters (anchors not included)
+            uint8_t data[MAX_PATTERN_LEN];
+
+            // Pattern length
+            uint8_t len;
+
+            // Include or exclude rule
+            t_rule rule;
+
+            // Anchored to the frame start or end
+            bool anchor_start;
+            bool anchor_end;
+        };
+
+        /**
+         * @brief Aho-Corasick automaton state (trie node). The children of a
+         * state are linked as a list of siblings.
+         */
+        struct s_state
+        {
+            // First child and next sibling states
+            uint16_t first_child;
+            uint16_t next_sibling;
+
+            // Failure link (longest proper suffix that is a trie node)
+            uint16_t fail;
+
+            // Character of the edge from the parent state
+            uint8_t ch;
+
+            // Patterns matched when reaching the state (bit per pattern,
+            // including the ones of the failure links chain)
+            uint16_t out;
+        };
+
+        /**
+         * @brief Filter patterns and automaton tables.
+         */
+        struct s_tables
+        {
+            // Filter patterns
+            s_pattern patterns[MAX_PATTERNS];
+
+            // Automaton states (state 0 is the root)
+            s_state states[MAX_STATES];
+        };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new Filter object (without patterns).
+         */
+        UARTFilter();
+
+        /**
+         * @brief Add a pattern and rebuild the automaton.
+         * @param rule Include or exclude rule.
+         * @param pattern Pattern string ("^" prefix and "$" suffix anchor it
+         * to the frame start and end).
+         * @param len Pattern string length.
+         * @return true Pattern added.
+         * @return false Invalid pattern, no room for it or not enough
+         * free memory for the filter tables.
+         */
+        bool add(const t_rule rule, const char* pattern, const uint32_t len);
+
+        /**
+         * @brief Remove all the patterns (every frame passes) and release
+         * the filter tables.
+         */
+        void clear();
+
+        /**
+         * @brief Check if a frame passes the filter (counting it as matched
+         * and/or dropped).
+         * @param data Frame data.
+         * @param len Frame length.
+         * @return true The frame passes the filter.
+         * @return false The frame must be dropped.
+         */
+        bool pass(const uint8_t* data, const uint32_t len);
+
+        /**
+         * @brief Get the number of patterns.
+         * @return uint8_t Number of patterns.
+         */
+        uint8_t get_num_patterns();
+
+        /**
+         * @brief Get the number of frames that matched any pattern.
+         * @return uint32_t Number of matched frames.
+         */
+        uint32_t get_num_matched();
+
+        /**
+         * @brief Get the number of frames dropped by the filter.
+         * @return uint32_t Number of dropped frames.
+         */
+        uint32_t get_num_dropped();
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Build the automaton from the unanchored patterns.
+         * @return true Automaton built.
+         * @return false Too many states.
+         */
+        bool build();
+
+        /**
+         * @brief Get the child of a state through a character.
+         * @param state Parent state.
+         * @param ch Edge character.
+         * @return uint16_t Child state (NO_STATE if there is none).
+         */
+        uint16_t child(const uint16_t state, const uint8_t ch);
+
+        /**
+         * @brief Get the patterns matched by a frame.
+         * @param data Frame data.
+         * @param len Frame length.
+         * @return uint16_t Matched patterns (bit per pattern).
+         */
+        uint16_t match(const uint8_t* data, const uint32_t len);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Filter tables memory (nullptr while there are no patterns).
+         */
+        s_tables* tables;
+
+        /**
+         * @brief Filter patterns (in the filter tables).
+         */
+        s_pattern* patterns;
+
+        /**
+         * @brief Number of filter patterns.
+         */
+        uint8_t num_patterns;
+
+        /**
+         * @brief Patterns with include rule (bit per pattern).
+         */
+        uint16_t include_mask;
+
+        /**
+         * @brief Patterns with exclude rule (bit per pattern).
+         */
+        uint16_t exclude_mask;
+
+        /**
+         * @brief Automaton states (in the filter tables, state 0 is the
+         * root).
+         */
+        s_state* states;
+
+        /**
+         * @brief Number of automaton states.
+         */
+        uint16_t num_states;
+
+        /**
+         * @brief Number of frames that matched any pattern.
+         */
+        uint32_t num_matched;
+
+        /**
+         * @brief Number of frames dropped by the filter.
+         */
+        uint32_t num_dropped;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_FILTER_H */
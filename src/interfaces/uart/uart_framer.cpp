@@ -0,0 +1,393 @@
+/**
+ * @file    uart_framer.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx Data Stream Framer source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_framer.h"
+
+// C++ Standard Libraries
+#include <cstring>
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes the Framer in LINE mode
+ * without buffer.
+ */
+UARTFramer::UARTFramer()
+{
+    buffer = nullptr;
+    capacity = 0U;
+    mode = ns_device::ns_uart::t_uart_framing::LINE;
+    delimiter = (uint8_t)('\n');
+    fixed_length = 0U;
+    num_errors = 0U;
+    reset();
+}
+
+/**
+ * @details This function sets the frame buffer, one byte of it is reserved
+ * for the NUL terminator.
+ */
+void UARTFramer::set_buffer(uint8_t* buffer, const uint32_t size)
+{
+    this->buffer = buffer;
+    capacity = ((buffer != nullptr) && (size > 0U)) ? (size - 1U) : 0U;
+    reset();
+}
+
+/**
+ * @details This function sets the framing mode parameters.
+ */
+void UARTFramer::set_mode(const ns_device::ns_uart::t_uart_framing mode,
+        const uint8_t delimiter, const uint32_t length)
+{
+    this->mode = mode;
+    this->delimiter = delimiter;
+    fixed_length = length;
+    if ( (fixed_length == 0U) || (fixed_length > capacity) )
+    {   fixed_length = capacity;   }
+    reset();
+}
+
+/**
+ * @details This function clears the frame building state.
+ */
+void UARTFramer::reset()
+{
+    length = 0U;
+    ready = false;
+    cobs_left = 0U;
+    cobs_zero_pending = false;
+    slip_escape = false;
+    skip = false;
+    if (buffer != nullptr)
+    {   buffer[0] = (uint8_t)('\0');   }
+}
+
+/**
+ * @details This function dispatches the received data to the current mode
+ * handler. Nothing is processed while a ready frame has not been released.
+ */
+uint32_t UARTFramer::feed(const uint8_t* data, const uint32_t len)
+{
+    using namespace ns_device::ns_uart;
+
+    if ( (ready) || (capacity == 0U) )
+    {   return 0U;   }
+
+    if (mode == t_uart_framing::LINE)
+    {   return feed_line(data, len);   }
+
+    if ( (mode == t_uart_framing::IDLE) || (mode == t_uart_framing::FIXED) )
+    {   return feed_raw(data, len);   }
+
+    // Byte-stuffing decoders
+    uint32_t i = 0U;
+    while ( (i < len) && (ready == false) )
+    {
+        if (mode == t_uart_framing::COBS)
+        {   feed_cobs(data[i]);   }
+        else
+        {   feed_slip(data[i]);   }
+        i = i + 1U;
+    }
+
+    return i;
+}
+
+/**
+ * @details This function marks the partial frame as ready if there is any
+ * data on it (and it was not being discarded).
+ */
+bool UARTFramer::flush()
+{
+    if (ready)
+    {   return true;   }
+
+    if ( (length == 0U) || (skip) )
+    {   return false;   }
+
+    complete();
+    return true;
+}
+
+/**
+ * @details Getter method to check if a frame is ready.
+ */
+bool UARTFramer::frame_ready()
+{   return ready;   }
+
+/**
+ * @details Getter method to get the frame data.
+ */
+const uint8_t* UARTFramer::get_frame()
+{   return buffer;   }
+
+/**
+ * @details Getter method to get the frame length.
+ */
+uint32_t UARTFramer::get_frame_length()
+{   return (ready) ? length : 0U;   }
+
+/**
+ * @details This function clears the ready frame.
+ */
+void UARTFramer::frame_done()
+{
+    length = 0U;
+    ready = false;
+    buffer[0] = (uint8_t)('\0');
+}
+
+/**
+ * @details Getter method to get the partial frame length.
+ */
+uint32_t UARTFramer::get_length()
+{   return length;   }
+
+/**
+ * @details Getter method to get the frame errors counter.
+ */
+uint32_t UARTFramer::get_num_errors()
+{   return num_errors;   }
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details This function stores the byte at the end of the frame keeping the
+ * frame NUL terminated.
+ */
+bool UARTFramer::append(const uint8_t byte)
+{
+    if (length >= capacity)
+    {   return false;   }
+
+    buffer[length] = byte;
+    length = length + 1U;
+    buffer[length] = (uint8_t)('\0');
+
+    return true;
+}
+
+/**
+ * @details This function sets the frame as ready and NUL terminates it.
+ */
+void UARTFramer::complete()
+{
+    buffer[length] = (uint8_t)('\0');
+    ready = true;
+}
+
+/**
+ * @details This function drops the partial frame and counts the error.
+ */
+void UARTFramer::discard()
+{
+    num_errors = num_errors + 1U;
+    length = 0U;
+    buffer[0] = (uint8_t)('\0');
+    skip = true;
+}
+
+/**
+ * @details This function searches the delimiter in the received data block
+ * and copy the data until it (or until the buffer is full) in one operation.
+ * A full buffer is handled as a complete frame.
+ */
+uint32_t UARTFramer::feed_line(const uint8_t* data, const uint32_t len)
+{
+    uint32_t to_copy = len;
+    uint32_t free_space = capacity - length;
+    bool found = false;
+
+    const uint8_t* ptr_delim = (const uint8_t*)(memchr(data, delimiter, len));
+    if (ptr_delim != nullptr)
+    {
+        to_copy = (uint32_t)(ptr_delim - data);
+        found = true;
+    }
+
+    if (to_copy >= free_space)
+    {
+        memcpy(&(buffer[length]), data, free_space);
+        length = capacity;
+        complete();
+        // Consume the delimiter too if it is just after the full buffer
+        if ( (found) && (to_copy == free_space) )
+        {   return free_space + 1U;   }
+        return free_space;
+    }
+
+    memcpy(&(buffer[length]), data, to_copy);
+    length = length + to_copy;
+    if (found)
+    {
+        complete();
+        return to_copy + 1U;
+    }
+
+    buffer[length] = (uint8_t)('\0');
+    return to_copy;
+}
+
+/**
+ * @details This function copies the received data until the frame is full.
+ * In FIXED mode the frame is full at the configured length, in IDLE mode a
+ * full buffer is handled as a complete frame.
+ */
+uint32_t UARTFramer::feed_raw(const uint8_t* data, const uint32_t len)
+{
+    using namespace ns_device::ns_uart;
+
+    uint32_t frame_size = capacity;
+    if (mode == t_uart_framing::FIXED)
+    {   frame_size = fixed_length;   }
+
+    uint32_t to_copy = frame_size - length;
+    if (to_copy > len)
+    {   to_copy = len;   }
+
+    memcpy(&(buffer[length]), data, to_copy);
+    length = length + to_copy;
+    buffer[length] = (uint8_t)('\0');
+    if (length >= frame_size)
+    {   complete();   }
+
+    return to_copy;
+}
+
+/**
+ * @details COBS streaming decoder. Each block starts with a code byte that
+ * tells the number of data bytes of the block plus one, and a zero must be
+ * inserted after each block with a code lower than 0xFF (except the last
+ * one of the frame, so the zero insertion is deferred until next block).
+ */
+void UARTFramer::feed_cobs(const uint8_t byte)
+{
+    // Frame delimiter
+    if (byte == COBS_DELIMITER)
+    {
+        bool malformed = (cobs_left != 0U);
+        bool was_skipping = skip;
+        cobs_left = 0U;
+        cobs_zero_pending = false;
+        skip = false;
+        if (was_skipping)
+        {   return;   }
+        if (malformed)
+        {
+            discard();
+            skip = false;
+            return;
+        }
+        if (length > 0U)
+        {   complete();   }
+        return;
+    }
+
+    // Ignore data of discarded frame
+    if (skip)
+    {   return;   }
+
+    // Block code byte
+    if (cobs_left == 0U)
+    {
+        if (cobs_zero_pending)
+        {
+            if (append(0x00U) == false)
+            {   discard(); return;   }
+        }
+        cobs_left = byte - 1U;
+        cobs_zero_pending = (byte != 0xFFU);
+        return;
+    }
+
+    // Block data byte
+    if (append(byte) == false)
+    {   discard(); return;   }
+    cobs_left = cobs_left - 1U;
+}
+
+/**
+ * @details SLIP streaming decoder. END character finish the frame (empty
+ * frames are ignored) and ESC character escapes END/ESC inside the data.
+ */
+void UARTFramer::feed_slip(const uint8_t byte)
+{
+    uint8_t decoded = byte;
+
+    // Frame delimiter
+    if (byte == SLIP_END)
+    {
+        bool was_skipping = skip;
+        slip_escape = false;
+        skip = false;
+        if ( (was_skipping == false) && (length > 0U) )
+        {   complete();   }
+        return;
+    }
+
+    // Ignore data of discarded frame
+    if (skip)
+    {   return;   }
+
+    // Escape sequences
+    if (slip_escape)
+    {
+        slip_escape = false;
+        if (byte == SLIP_ESC_END)
+        {   decoded = SLIP_END;   }
+        else if (byte == SLIP_ESC_ESC)
+        {   decoded = SLIP_ESC;   }
+    }
+    else if (byte == SLIP_ESC)
+    {
+        slip_escape = true;
+        return;
+    }
+
+    if (append(decoded) == false)
+    {   discard();   }
+}
+
+/*****************************************************************************/
@@ -0,0 +1,303 @@
+/**
+ * @file    uart_framer.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx Data Stream Framer header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_FRAMER_H
+#define UART_FRAMER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+// Global Data
+#include "../../global/global.h"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief Split (and decode) an UART Rx data stream into frames, following the
+ * configured framing mode:
+ * - LINE: Frames end with a delimiter character (not included in the frame).
+ * - IDLE: Frames end after an inter-byte silence (the time check is done by
+ *   the user through flush()).
+ * - FIXED: Frames have a fixed number of bytes.
+ * - COBS: Consistent Overhead Byte Stuffing frames, delimited by 0x00.
+ * - SLIP: Serial Line Internet Protocol frames, delimited by 0xC0.
+ * Frames are binary safe (handled by length), but they are also kept NUL
+ * terminated in the buffer (not counted in length) to ease text handling.
+ */
+class UARTFramer
+{
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief SLIP special characters.
+         */
+        static constexpr uint8_t SLIP_END = 0xC0U;
+        static constexpr uint8_t SLIP_ESC = 0xDBU;
+        static constexpr uint8_t SLIP_ESC_END = 0xDCU;
+        static constexpr uint8_t SLIP_ESC_ESC = 0xDDU;
+
+        /**
+         * @brief COBS frame delimiter.
+         */
+        static constexpr uint8_t COBS_DELIMITER = 0x00U;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new UART Framer object (without buffer).
+         */
+        UARTFramer();
+
+        /**
+         * @brief Set the buffer where frames are built and clear it.
+         * @param buffer Frame buffer memory.
+         * @param size Frame buffer size (including NUL terminator).
+         */
+        void set_buffer(uint8_t* buffer, const uint32_t size);
+
+        /**
+         * @brief Set the framing mode and clear any partial frame.
+         * @param mode Framing mode.
+         * @param delimiter End of frame character for LINE mode.
+         * @param length Frame length for FIXED mode.
+         */
+        void set_mode(const ns_device::ns_uart::t_uart_framing mode,
+                const uint8_t delimiter, const uint32_t length);
+
+        /**
+         * @brief Discard any partial or ready frame.
+         */
+        void reset();
+
+        /**
+         * @brief Process received data until a frame is completed or all
+         * data is processed.
+         * @param data Received data.
+         * @param len Number of received bytes.
+         * @return uint32_t Number of bytes processed.
+         */
+        uint32_t feed(const uint8_t* data, const uint32_t len);
+
+        /**
+         * @brief Force the bytes of the current partial frame to be
+         * handled as a complete frame (i.e. idle timeout).
+         * @return true A frame is ready.
+         * @return false There was no data to flush.
+         */
+        bool flush();
+
+        /**
+         * @brief Check if a complete frame is ready.
+         * @return true A frame is ready.
+         * @return false No frame is ready.
+         */
+        bool frame_ready();
+
+        /**
+         * @brief Get the ready frame data.
+         * @return const uint8_t* Frame data (NUL terminated).
+         */
+        const uint8_t* get_frame();
+
+        /**
+         * @brief Get the number of bytes of the ready frame.
+         * @return uint32_t Frame length.
+         */
+        uint32_t get_frame_length();
+
+        /**
+         * @brief Release the ready frame to start building the next one.
+         */
+        void frame_done();
+
+        /**
+         * @brief Get the number of bytes of the frame being built.
+         * @return uint32_t Number of bytes of the partial frame.
+         */
+        uint32_t get_length();
+
+        /**
+         * @brief Get the number of discarded malformed or oversized
+         * frames (COBS/SLIP).
+         * @return uint32_t Number of frame errors.
+         */
+        uint32_t get_num_errors();
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Append a decoded byte to the frame being built.
+         * @param byte Byte to append.
+         * @return true Byte appended.
+         * @return false Buffer full.
+         */
+        bool append(const uint8_t byte);
+
+        /**
+         * @brief Mark the frame being built as ready.
+         */
+        void complete();
+
+        /**
+         * @brief Discard the frame being built and skip data until next
+         * frame delimiter.
+         */
+        void discard();
+
+        /**
+         * @brief Process data in LINE mode.
+         * @param data Received data.
+         * @param len Number of received bytes.
+         * @return uint32_t Number of bytes processed.
+         */
+        uint32_t feed_line(const uint8_t* data, const uint32_t len);
+
+        /**
+         * @brief Process data in IDLE/FIXED mode (raw copy).
+         * @param data Received data.
+         * @param len Number of received bytes.
+         * @return uint32_t Number of bytes processed.
+         */
+        uint32_t feed_raw(const uint8_t* data, const uint32_t len);
+
+        /**
+         * @brief Process a byte in COBS mode.
+         * @param byte Received byte.
+         */
+        void feed_cobs(const uint8_t byte);
+
+        /**
+         * @brief Process a byte in SLIP mode.
+         * @param byte Received byte.
+         */
+        void feed_slip(const uint8_t byte);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Frame buffer.
+         */
+        uint8_t* buffer;
+
+        /**
+         * @brief Maximum number of bytes of a frame.
+         */
+        uint32_t capacity;
+
+        /**
+         * @brief Number of bytes of the frame being built.
+         */
+        uint32_t length;
+
+        /**
+         * @brief Frame is complete and ready.
+         */
+        bool ready;
+
+        /**
+         * @brief Framing mode.
+         */
+        ns_device::ns_uart::t_uart_framing mode;
+
+        /**
+         * @brief LINE mode delimiter.
+         */
+        uint8_t delimiter;
+
+        /**
+         * @brief FIXED mode frame length.
+         */
+        uint32_t fixed_length;
+
+        /**
+         * @brief COBS decoder: bytes left of current block.
+         */
+        uint8_t cobs_left;
+
+        /**
+         * @brief COBS decoder: a zero must be appended before next block.
+         */
+        bool cobs_zero_pending;
+
+        /**
+         * @brief SLIP decoder: last byte was an escape character.
+         */
+        bool slip_escape;
+
+        /**
+         * @brief Skip data until next frame delimiter (malformed or
+         * oversized frame).
+         */
+        bool skip;
+
+        /**
+         * @brief Number of discarded frames.
+         */
+        uint32_t num_errors;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_FRAMER_H */
@@ -0,0 +1,158 @@
+/**
+ * @file    uart_line_events.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART line events (errors and BREAK) queue source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_line_events.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes an empty queue and the
+ * event counters.
+ */
+UARTLineEvents::UARTLineEvents()
+{
+    for (uint32_t i = 0U; i < NUM_EVENTS; i++)
+    {
+        events[i].offset = 0U;
+        events[i].t_us = 0;
+        events[i].type = t_event::BREAK;
+    }
+    for (uint8_t i = 0U; i < (uint8_t)(t_event::NUM_TYPES); i++)
+    {   counts[i] = 0U;   }
+    reset();
+}
+
+/**
+ * @details This function clears the queue read/write counters.
+ */
+void UARTLineEvents::reset()
+{
+    head.store(0U, std::memory_order_relaxed);
+    tail.store(0U, std::memory_order_relaxed);
+}
+
+/**
+ * @details This function counts the event, then stores it and publish it to
+ * the consumer (release ordering, so the consumer sees the event before the
+ * new counter).
+ */
+void UARTLineEvents::push(const t_event type, const uint32_t offset,
+        const int64_t t_us)
+{
+    // Do nothing if the event type is invalid
+    if (type >= t_event::NUM_TYPES)
+    {   return;   }
+
+    counts[(uint8_t)(type)] = counts[(uint8_t)(type)] + 1U;
+
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_acquire);
+    if (h - t >= NUM_EVENTS)
+    {   return;   }
+
+    s_event* event = &(events[h & (NUM_EVENTS - 1U)]);
+    event->offset = offset;
+    event->t_us = t_us;
+    event->type = type;
+    head.store(h + 1U, std::memory_order_release);
+}
+
+/**
+ * @details This function gets the oldest queued event if its position is not
+ * after the provided one (wrap-around safe).
+ */
+bool UARTLineEvents::peek(const uint32_t offset, s_event* event)
+{
+    uint32_t event_offset = 0U;
+    if (next_offset(&event_offset) == false)
+    {   return false;   }
+
+    uint32_t bytes_after = event_offset - offset;
+    if ( (bytes_after > 0U) && (bytes_after <= (UINT32_MAX >> 1)) )
+    {   return false;   }
+
+    *event = events[tail.load(std::memory_order_relaxed) &
+        (NUM_EVENTS - 1U)];
+    return true;
+}
+
+/**
+ * @details This function gets the position of the oldest queued event.
+ */
+bool UARTLineEvents::next_offset(uint32_t* offset)
+{
+    uint32_t h = head.load(std::memory_order_acquire);
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == h)
+    {   return false;   }
+
+    *offset = events[t & (NUM_EVENTS - 1U)].offset;
+    return true;
+}
+
+/**
+ * @details This function releases the oldest queued event slot to the
+ * producer.
+ */
+void UARTLineEvents::pop()
+{
+    uint32_t h = head.load(std::memory_order_acquire);
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == h)
+    {   return;   }
+
+    tail.store(t + 1U, std::memory_order_release);
+}
+
+/**
+ * @details Getter method to return the number of events of a type.
+ */
+uint32_t UARTLineEvents::get_count(const t_event type)
+{
+    // Do nothing if the event type is invalid
+    if (type >= t_event::NUM_TYPES)
+    {   return 0U;   }
+
+    return counts[(uint8_t)(type)];
+}
+
+/*****************************************************************************/
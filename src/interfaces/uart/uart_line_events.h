@@ -0,0 +1,202 @@
+/**
+ * @file    uart_line_events.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART line events (errors and BREAK) queue header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_LINE_EVENTS_H
+#define UART_LINE_EVENTS_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief Single-producer single-consumer lock-free queue of the UART line
+ * events (reception errors, BREAK conditions and data losses) of a Port. The
+ * capture side pushes each event with its position in the Rx ring buffer
+ * data stream (ring buffer write counter) and its time, so the publisher side
+ * can put it in-band, exactly between the bytes received before and after it.
+ * The number of events of each type is counted even if the queue is full.
+ */
+class UARTLineEvents
+{
+    /******************************************************************/
+
+    /* Public Data Types */
+
+    public:
+
+        /**
+         * @brief UART line event types.
+         */
+        enum class t_event : uint8_t
+        {
+            PARITY_ERR = 0U,
+            FRAME_ERR = 1U,
+            BREAK = 2U,
+            FIFO_OVF = 3U,
+            BUFFER_FULL = 4U,
+            NUM_TYPES = 5U
+        };
+
+        /**
+         * @brief UART line event.
+         */
+        struct s_event
+        {
+            // Ring buffer write counter when the event happened
+            uint32_t offset;
+
+            // Event time (us)
+            int64_t t_us;
+
+            // Event type
+            t_event type;
+        };
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Number of events that can be queued (power of two).
+         */
+        static constexpr uint32_t NUM_EVENTS = 32U;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new Line Events object.
+         */
+        UARTLineEvents();
+
+        /**
+         * @brief Clear the queued events (the counters are kept). Must not
+         * be called while producer or consumer are running.
+         */
+        void reset();
+
+        /**
+         * @brief Count an event and add it to the queue (producer side). The
+         * event is dropped if the queue is full.
+         * @param type Event type.
+         * @param offset Ring buffer write counter when the event happened.
+         * @param t_us Event time (us).
+         */
+        void push(const t_event type, const uint32_t offset,
+                const int64_t t_us);
+
+        /**
+         * @brief Get the oldest queued event that happened at or before a
+         * position of the data stream (consumer side).
+         * @param offset Ring buffer read counter of the position.
+         * @param event Pointer to store the event.
+         * @return true Event got.
+         * @return false No event at or before the position.
+         */
+        bool peek(const uint32_t offset, s_event* event);
+
+        /**
+         * @brief Get the ring buffer write counter of the oldest queued event
+         * (consumer side).
+         * @param offset Pointer to store the event ring buffer write counter.
+         * @return true There is a queued event.
+         * @return false Empty queue.
+         */
+        bool next_offset(uint32_t* offset);
+
+        /**
+         * @brief Remove the oldest queued event (consumer side).
+         */
+        void pop();
+
+        /**
+         * @brief Get the number of events of a type since boot.
+         * @param type Event type.
+         * @return uint32_t Number of events.
+         */
+        uint32_t get_count(const t_event type);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Queued events.
+         */
+        s_event events[NUM_EVENTS];
+
+        /**
+         * @brief Number of events of each type (only modified by the
+         * producer).
+         */
+        uint32_t counts[(uint8_t)(t_event::NUM_TYPES)];
+
+        /**
+         * @brief Write counter (only modified by the producer).
+         */
+        std::atomic<uint32_t> head;
+
+        /**
+         * @brief Read counter (only modified by the consumer).
+         */
+        std::atomic<uint32_t> tail;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_LINE_EVENTS_H */
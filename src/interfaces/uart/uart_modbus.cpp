@@ -0,0 +1,445 @@
+/**
+ * @file    uart_modbus.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Modbus RTU sniffer decoder source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_modbus.h"
+
+// C++ Standard Libraries
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Configuration Data
+#include "config.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes the decoder without
+ * pending request and with the default response timeout.
+ */
+UARTModbus::UARTModbus()
+{
+    memset((void*)(request), 0, sizeof(request));
+    memset((void*)(record), 0, sizeof(record));
+    request_len = 0U;
+    t_request_us = 0;
+    t_request_end_us = 0;
+    record_len = 0U;
+    record_slave = 0U;
+    timeout_us = ns_const::DEFAULT_UART_MODBUS_TIMEOUT_MS * 1000U;
+}
+
+/**
+ * @details The only option is the response timeout in ms (1 to
+ * MAX_TIMEOUT_MS), applied to the pending request too.
+ */
+bool UARTModbus::configure(int argc, char* argv[])
+{
+    // Nothing to configure
+    if (argc == 0)
+    {   return true;   }
+
+    // Do nothing if the timeout is not a number in range
+    char* end = nullptr;
+    unsigned long timeout_ms = strtoul(argv[0], &end, 10);
+    if ( (argc > 1) || (end == argv[0]) || (*end != '\0') ||
+         (timeout_ms == 0U) || (timeout_ms > MAX_TIMEOUT_MS) )
+    {   return false;   }
+
+    timeout_us = (uint32_t)(timeout_ms) * 1000U;
+
+    return true;
+}
+
+/**
+ * @details Getter method to return the IDLE framing with the protocol
+ * silent interval (rounded down, as the framer only counts whole
+ * characters).
+ */
+void UARTModbus::get_framing(t_framing* framing, uint32_t* param)
+{
+    *framing = t_framing::IDLE;
+    *param = IDLE_CHARS;
+}
+
+/**
+ * @details The requests times and responses latencies are taken from the
+ * frames first byte arrival time.
+ */
+bool UARTModbus::needs_timestamps()
+{
+    return true;
+}
+
+/**
+ * @details This function splits the frame in Modbus RTU frames (several
+ * frames are captured together if the silent interval between them was not
+ * detected) and decodes them, emitting each completed transaction record.
+ * The start time of the frames after the first one is estimated from the
+ * bytes received before it at the Port speed.
+ */
+void UARTModbus::feed(const uint8_t* data, const uint32_t len,
+        const int64_t t_us)
+{
+    uint32_t num_used = 0U;
+    while (num_used < len)
+    {
+        uint32_t frame_len = frame_length(&(data[num_used]), len - num_used);
+        if (frame_len == 0U)
+        {   break;   }
+
+        int64_t t_frame_us = t_us +
+            ((int64_t)(num_used) * (int64_t)(char_time_us));
+        if (decode(&(data[num_used]), frame_len, t_frame_us))
+        {   emit_record();   }
+        num_used = num_used + frame_len;
+    }
+}
+
+/**
+ * @details This function completes the pending request as not responded if
+ * the response timeout has elapsed since its end (broadcast requests are
+ * always completed this way).
+ */
+void UARTModbus::flush(const int64_t t_now_us)
+{
+    // Do nothing if there is no pending request
+    if (request_len == 0U)
+    {   return;   }
+
+    // Do nothing if the response can still arrive
+    if (t_now_us - t_request_end_us < (int64_t)(timeout_us))
+    {   return;   }
+
+    build_record(nullptr, 0U, RECORD_NO_RESPONSE);
+    request_len = 0U;
+    emit_record();
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details The CRC16 of a frame including its CRC (low byte first) is 0, so
+ * the whole block is checked first, and then its prefixes (the first one
+ * with a valid CRC is taken, the rest of the block is checked later).
+ */
+uint32_t UARTModbus::frame_length(const uint8_t* data, const uint32_t len)
+{
+    if ( (len >= MIN_FRAME_SIZE) && (len <= MAX_FRAME_SIZE) &&
+         (crc16(0xFFFFU, data, len) == 0U) )
+    {   return len;   }
+
+    uint16_t crc = 0xFFFFU;
+    for (uint32_t i = 0U; (i < len) && (i < MAX_FRAME_SIZE); i++)
+    {
+        crc = crc16(crc, &(data[i]), 1U);
+        if ( (i + 1U >= MIN_FRAME_SIZE) && (crc == 0U) )
+        {   return i + 1U;   }
+    }
+
+    num_errors = num_errors + 1U;
+    return 0U;
+}
+
+/**
+ * @details A frame from the slave of the pending request, with its function
+ * code (or its exception response) and the response length of that
+ * function, is its response. Otherwise, if the frame has the format of a
+ * request it becomes the pending one, and the previous pending request is
+ * completed as not responded. Frames that are neither of them (i.e.
+ * responses of requests captured before the sniffer started) are ignored.
+ */
+bool UARTModbus::decode(const uint8_t* frame, const uint32_t len,
+        const int64_t t_us)
+{
+    // Do nothing if the frame is not valid
+    if ( (len < MIN_FRAME_SIZE) || (len > MAX_FRAME_SIZE) )
+    {   return false;   }
+
+    if ( (request_len > 0U) && is_response(frame, len) )
+    {
+        int64_t latency = t_us - t_request_end_us;
+        if (latency < 0)
+        {   latency = 0;   }
+        if (latency >= (int64_t)(RECORD_NO_RESPONSE))
+        {   latency = (int64_t)(RECORD_NO_RESPONSE) - 1;   }
+        build_record(frame, len, (uint32_t)(latency));
+        request_len = 0U;
+        return true;
+    }
+
+    // Do nothing if the frame is not a request
+    if (is_request(frame, len) == false)
+    {   return false;   }
+
+    bool record_ready = false;
+    if (request_len > 0U)
+    {
+        build_record(nullptr, 0U, RECORD_NO_RESPONSE);
+        record_ready = true;
+    }
+
+    memcpy((void*)(request), (const void*)(frame), len);
+    request_len = len;
+    t_request_us = t_us;
+    t_request_end_us = t_us + ((int64_t)(len) * (int64_t)(char_time_us));
+
+    return record_ready;
+}
+
+/**
+ * @details This function emits the record on the subtopic of the slave
+ * address (in decimal), so each slave can be subscribed on its own.
+ */
+void UARTModbus::emit_record()
+{
+    char subtopic[4];
+    snprintf(subtopic, sizeof(subtopic), "%u", (unsigned)(record_slave));
+    emit(subtopic, record, record_len);
+}
+
+/**
+ * @details The request length is fixed for the read and single write
+ * functions, and given by its byte count for the multiple write functions.
+ * Exception responses are never requests, and other function codes are
+ * assumed to be requests.
+ */
+bool UARTModbus::is_request(const uint8_t* frame, const uint32_t len)
+{
+    uint8_t function = frame[1];
+    uint32_t pdu_len = len - MIN_FRAME_SIZE;
+
+    if ((function & EXCEPTION_BIT) != 0U)
+    {   return false;   }
+
+    switch (function)
+    {
+        case FC_READ_COILS:
+        case FC_READ_DISCRETE_INPUTS:
+        case FC_READ_HOLDING_REGISTERS:
+        case FC_READ_INPUT_REGISTERS:
+        case FC_WRITE_SINGLE_COIL:
+        case FC_WRITE_SINGLE_REGISTER:
+            return (pdu_len == 4U);
+
+        case FC_WRITE_MULTIPLE_COILS:
+        case FC_WRITE_MULTIPLE_REGISTERS:
+            return (pdu_len >= 5U) && (pdu_len == 5U + frame[6]);
+
+        default:
+            return true;
+    }
+}
+
+/**
+ * @details The response must come from the slave of the request, with its
+ * function code and the response length of the function (the byte count
+ * for the read functions, fixed for the write ones and the exceptions).
+ */
+bool UARTModbus::is_response(const uint8_t* frame, const uint32_t len)
+{
+    uint8_t function = frame[1] & (uint8_t)(~EXCEPTION_BIT);
+    uint32_t pdu_len = len - MIN_FRAME_SIZE;
+
+    if ( (frame[0] != request[0]) || (function != request[1]) )
+    {   return false;   }
+
+    if ((frame[1] & EXCEPTION_BIT) != 0U)
+    {   return (pdu_len == 1U);   }
+
+    switch (function)
+    {
+        case FC_READ_COILS:
+        case FC_READ_DISCRETE_INPUTS:
+        case FC_READ_HOLDING_REGISTERS:
+        case FC_READ_INPUT_REGISTERS:
+            return (pdu_len >= 1U) && (pdu_len == 1U + frame[2]);
+
+        case FC_WRITE_SINGLE_COIL:
+        case FC_WRITE_SINGLE_REGISTER:
+        case FC_WRITE_MULTIPLE_COILS:
+        case FC_WRITE_MULTIPLE_REGISTERS:
+            return (pdu_len == 4U);
+
+        default:
+            return true;
+    }
+}
+
+/**
+ * @details This function writes the record header with the request time,
+ * the latency, the function and exception codes, and the address range of
+ * the request, followed by the values read (from the response) or written
+ * (from the request).
+ */
+void UARTModbus::build_record(const uint8_t* response, const uint32_t len,
+        const uint32_t latency_us)
+{
+    uint8_t function = request[1];
+    const uint8_t* req_pdu = &(request[2]);
+    uint32_t req_pdu_len = request_len - MIN_FRAME_SIZE;
+    uint8_t exception = 0U;
+    if ( (response != nullptr) && ((response[1] & EXCEPTION_BIT) != 0U) )
+    {   exception = response[2];   }
+
+    uint64_t t_us = (uint64_t)(t_request_us);
+    for (uint8_t i = 0U; i < 8U; i++)
+    {   record[i] = (uint8_t)((t_us >> (8U * i)) & 0xFFU);   }
+    for (uint8_t i = 0U; i < 4U; i++)
+    {   record[8U + i] = (uint8_t)((latency_us >> (8U * i)) & 0xFFU);   }
+    record[12] = function;
+    record[13] = exception;
+    record[14] = 0U;
+    record[15] = 0U;
+    record[16] = 0U;
+    record[17] = 0U;
+    record_len = RECORD_HEADER_SIZE;
+    record_slave = request[0];
+
+    // Address and count (big endian on the bus)
+    bool is_known = (function == FC_READ_COILS) ||
+        (function == FC_READ_DISCRETE_INPUTS) ||
+        (function == FC_READ_HOLDING_REGISTERS) ||
+        (function == FC_READ_INPUT_REGISTERS) ||
+        (function == FC_WRITE_SINGLE_COIL) ||
+        (function == FC_WRITE_SINGLE_REGISTER) ||
+        (function == FC_WRITE_MULTIPLE_COILS) ||
+        (function == FC_WRITE_MULTIPLE_REGISTERS);
+    if (is_known)
+    {
+        record[14] = req_pdu[1];
+        record[15] = req_pdu[0];
+        record[16] = req_pdu[3];
+        record[17] = req_pdu[2];
+    }
+    if ( (function == FC_WRITE_SINGLE_COIL) ||
+         (function == FC_WRITE_SINGLE_REGISTER) )
+    {
+        record[16] = 1U;
+        record[17] = 0U;
+    }
+
+    // No values for exceptions
+    if (exception != 0U)
+    {   return;   }
+
+    switch (function)
+    {
+        case FC_READ_COILS:
+        case FC_READ_DISCRETE_INPUTS:
+            if (response != nullptr)
+            {   append_values(&(response[3]), len - 5U, false);   }
+            break;
+
+        case FC_READ_HOLDING_REGISTERS:
+        case FC_READ_INPUT_REGISTERS:
+            if (response != nullptr)
+            {   append_values(&(response[3]), len - 5U, true);   }
+            break;
+
+        case FC_WRITE_SINGLE_COIL:
+        case FC_WRITE_SINGLE_REGISTER:
+            append_values(&(req_pdu[2]), 2U, true);
+            break;
+
+        case FC_WRITE_MULTIPLE_COILS:
+            append_values(&(req_pdu[5]), req_pdu_len - 5U, false);
+            break;
+
+        case FC_WRITE_MULTIPLE_REGISTERS:
+            append_values(&(req_pdu[5]), req_pdu_len - 5U, true);
+            break;
+
+        default:
+            if (response != nullptr)
+            {   append_values(&(response[2]), len - MIN_FRAME_SIZE, false);   }
+            else
+            {   append_values(req_pdu, req_pdu_len, false);   }
+            break;
+    }
+}
+
+/**
+ * @details This function copies the values to the record, swapping the
+ * bytes of the registers to little endian.
+ */
+void UARTModbus::append_values(const uint8_t* data, const uint32_t len,
+        const bool registers)
+{
+    uint8_t* values = &(record[record_len]);
+    memcpy((void*)(values), (const void*)(data), len);
+    if (registers)
+    {
+        for (uint32_t i = 0U; i + 1U < len; i = i + 2U)
+        {
+            values[i] = data[i + 1U];
+            values[i + 1U] = data[i];
+        }
+    }
+    record_len = record_len + len;
+}
+
+/**
+ * @details This function calculates the CRC16 of the data with the Modbus
+ * polynomial (0xA001, reflected) bit by bit.
+ */
+uint16_t UARTModbus::crc16(uint16_t crc, const uint8_t* data,
+        const uint32_t len)
+{
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        crc = crc ^ data[i];
+        for (uint8_t b = 0U; b < 8U; b++)
+        {
+            if ((crc & 1U) != 0U)
+            {   crc = (crc >> 1) ^ 0xA001U;   }
+            else
+            {   crc = crc >> 1;   }
+        }
+    }
+
+    return crc;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,314 @@
+/**
+ * @file    uart_modbus.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Modbus RTU sniffer decoder header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_MODBUS_H
+#define UART_MODBUS_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+// UART Protocol Decoders Framework
+#include "uart_decoder.h"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief Modbus RTU bus sniffer decoder. The frames captured from the bus
+ * (split by the silent interval) are validated with their CRC16, and each
+ * request from the master is paired with the response of the slave, to
+ * emit a record of the transaction on the subtopic of the slave address:
+ * - Request time (8 bytes, us since device boot).
+ * - Response latency (4 bytes, us from the end of the request to the start
+ *   of the response, RECORD_NO_RESPONSE if the slave didn't answer).
+ * - Function code (1 byte, without the exception bit).
+ * - Exception code (1 byte, 0 if there was no exception).
+ * - First register/coil address (2 bytes).
+ * - Number of registers/coils (2 bytes).
+ * - Values: The registers (2 bytes each) or the coils (packed bits, first
+ *   coil in the least significant bit) read or written. For other function
+ *   codes, the response data (or the request data if there is no response).
+ * All the record fields are little endian.
+ */
+class UARTModbus : public UARTDecoder
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+    public:
+
+        /**
+         * @brief Decoder name.
+         */
+        static constexpr char NAME[] = "modbus";
+
+        /**
+         * @brief Record header size.
+         */
+        static constexpr uint32_t RECORD_HEADER_SIZE = 18U;
+
+        /**
+         * @brief Record latency of requests without response.
+         */
+        static constexpr uint32_t RECORD_NO_RESPONSE = 0xFFFFFFFFU;
+
+        /**
+         * @brief Maximum frame size (Modbus RTU ADU).
+         */
+        static constexpr uint32_t MAX_FRAME_SIZE = 256U;
+
+        /**
+         * @brief Maximum response timeout (ms).
+         */
+        static constexpr uint32_t MAX_TIMEOUT_MS = 10000U;
+
+        /**
+         * @brief IDLE framing silence (characters). The protocol inter-frame
+         * silence is 3.5 characters, and gaps longer than 1.5 characters are
+         * not allowed inside a frame.
+         */
+        static constexpr uint8_t IDLE_CHARS = 3U;
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Minimum frame size (address, function code and CRC).
+         */
+        static constexpr uint32_t MIN_FRAME_SIZE = 4U;
+
+        /**
+         * @brief Function code exception response bit.
+         */
+        static constexpr uint8_t EXCEPTION_BIT = 0x80U;
+
+        /**
+         * @brief Function codes with a decoded record.
+         */
+        static constexpr uint8_t FC_READ_COILS = 0x01U;
+        static constexpr uint8_t FC_READ_DISCRETE_INPUTS = 0x02U;
+        static constexpr uint8_t FC_READ_HOLDING_REGISTERS = 0x03U;
+        static constexpr uint8_t FC_READ_INPUT_REGISTERS = 0x04U;
+        static constexpr uint8_t FC_WRITE_SINGLE_COIL = 0x05U;
+        static constexpr uint8_t FC_WRITE_SINGLE_REGISTER = 0x06U;
+        static constexpr uint8_t FC_WRITE_MULTIPLE_COILS = 0x0FU;
+        static constexpr uint8_t FC_WRITE_MULTIPLE_REGISTERS = 0x10U;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new Modbus decoder object.
+         */
+        UARTModbus();
+
+        /**
+         * @brief Configure the decoder options: [timeout_ms] (response
+         * timeout).
+         * @param argc Number of option arguments.
+         * @param argv Option arguments.
+         * @return true Configuration success.
+         * @return false Invalid option.
+         */
+        bool configure(int argc, char* argv[]) override;
+
+        /**
+         * @brief Get the Rx framing required by the decoder (IDLE framing
+         * with the protocol silent interval).
+         * @param framing Framing mode.
+         * @param param Framing mode parameter.
+         */
+        void get_framing(t_framing* framing, uint32_t* param) override;
+
+        /**
+         * @brief Check if the decoder requires the Rx frames timestamps
+         * (for the requests times and responses latencies).
+         * @return true Always.
+         */
+        bool needs_timestamps() override;
+
+        /**
+         * @brief Feed a Rx frame (that can contain several Modbus frames if
+         * the silent interval between them was not detected), emitting the
+         * completed transactions records.
+         * @param data Frame data.
+         * @param len Frame length.
+         * @param t_us Frame first byte arrival time (us).
+         */
+        void feed(const uint8_t* data, const uint32_t len,
+                const int64_t t_us) override;
+
+        /**
+         * @brief Emit the pending request as not responded if its response
+         * timeout has elapsed.
+         * @param t_now_us Current time (us).
+         */
+        void flush(const int64_t t_now_us) override;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Get the length of the first valid frame of a captured data
+         * block (that can contain several frames), counting an error if
+         * there is none.
+         * @param data Captured data.
+         * @param len Captured data length.
+         * @return uint32_t Frame length (0 if there is no valid frame).
+         */
+        uint32_t frame_length(const uint8_t* data, const uint32_t len);
+
+        /**
+         * @brief Decode a valid frame: a response completes the pending
+         * request record, and a request replaces it (completing the previous
+         * one as not responded).
+         * @param frame Frame data (with its CRC).
+         * @param len Frame length.
+         * @param t_us Frame start time (us).
+         * @return true A record is ready.
+         * @return false No record.
+         */
+        bool decode(const uint8_t* frame, const uint32_t len,
+                const int64_t t_us);
+
+        /**
+         * @brief Emit the last record on the subtopic of its slave.
+         */
+        void emit_record();
+
+        /**
+         * @brief Check if a frame has the format of a request.
+         * @param frame Frame data.
+         * @param len Frame length.
+         * @return true Request format.
+         * @return false Not a request.
+         */
+        static bool is_request(const uint8_t* frame, const uint32_t len);
+
+        /**
+         * @brief Check if a frame has the format of a response to the
+         * pending request.
+         * @param frame Frame data.
+         * @param len Frame length.
+         * @return true Response of the pending request.
+         * @return false Not a response of the pending request.
+         */
+        bool is_response(const uint8_t* frame, const uint32_t len);
+
+        /**
+         * @brief Build the record of the pending request.
+         * @param response Response frame (nullptr if there is none).
+         * @param len Response frame length.
+         * @param latency_us Response latency.
+         */
+        void build_record(const uint8_t* response, const uint32_t len,
+                const uint32_t latency_us);
+
+        /**
+         * @brief Append values to the record.
+         * @param data Values data.
+         * @param len Values data length.
+         * @param registers Values are registers (big endian on the bus).
+         */
+        void append_values(const uint8_t* data, const uint32_t len,
+                const bool registers);
+
+        /**
+         * @brief Calculate the Modbus CRC16.
+         * @param crc Initial CRC.
+         * @param data Data.
+         * @param len Data length.
+         * @return uint16_t CRC.
+         */
+        static uint16_t crc16(uint16_t crc, const uint8_t* data,
+                const uint32_t len);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Pending request frame (waiting for its response).
+         */
+        uint8_t request[MAX_FRAME_SIZE];
+        uint32_t request_len;
+
+        /**
+         * @brief Pending request start and end times (us).
+         */
+        int64_t t_request_us;
+        int64_t t_request_end_us;
+
+        /**
+         * @brief Last record and its slave address.
+         */
+        uint8_t record[RECORD_HEADER_SIZE + MAX_FRAME_SIZE];
+        uint32_t record_len;
+        uint8_t record_slave;
+
+        /**
+         * @brief Response timeout (us).
+         */
+        uint32_t timeout_us;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_MODBUS_H */
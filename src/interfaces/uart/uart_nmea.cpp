@@ -0,0 +1,999 @@
+/**
+ * @file    uart_nmea.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART NMEA 0183 decoder source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_nmea.h"
+
+// C++ Standard Libraries
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes the decoder without fix
+ * and with the default deadbands: 2 m of position and altitude, 0.2 knots,
+ * 5 degrees of course, 0.2 of HDOP and 3 dB of mean SNR.
+ */
+UARTNmea::UARTNmea()
+{
+    deadband[(uint8_t)(t_deadband::POS)] = 200U;
+    deadband[(uint8_t)(t_deadband::ALT)] = 200U;
+    deadband[(uint8_t)(t_deadband::SPEED)] = 20U;
+    deadband[(uint8_t)(t_deadband::COURSE)] = 500U;
+    deadband[(uint8_t)(t_deadband::HDOP)] = 20U;
+    deadband[(uint8_t)(t_deadband::SNR)] = 300U;
+    memset((void*)(record), 0, sizeof(record));
+    for (uint8_t i = 0U; i < MAX_FIELDS; i++)
+    {
+        field[i] = nullptr;
+        field_len[i] = 0U;
+    }
+    num_fields = 0U;
+    memset((void*)(&fix), 0, sizeof(fix));
+    memset((void*)(&published), 0, sizeof(published));
+    memset((void*)(sky), 0, sizeof(sky));
+    memset((void*)(sky_rx), 0, sizeof(sky_rx));
+    epoch_pending = false;
+    t_last_us = 0;
+    record_len = 0U;
+    raw = false;
+}
+
+/**
+ * @details The options are applied one at a time. The deadbands are given
+ * in the field unit (meters, meters, knots, degrees, HDOP and dB) and
+ * applied from the next epoch.
+ */
+bool UARTNmea::configure(int argc, char* argv[])
+{
+    // Nothing to configure
+    if (argc == 0)
+    {   return true;   }
+
+    // Raw lines publishing
+    if ( (strcmp(argv[0], "raw") == 0) && (argc == 2) )
+    {
+        if (strcmp(argv[1], "on") == 0)
+        {   raw = true;   }
+        else if (strcmp(argv[1], "off") == 0)
+        {   raw = false;   }
+        else
+        {   return false;   }
+        return true;
+    }
+
+    // Field deadband
+    if ( (strcmp(argv[0], "db") == 0) && (argc == 3) )
+    {
+        t_deadband field;
+        if (strcmp(argv[1], "pos") == 0)
+        {   field = t_deadband::POS;   }
+        else if (strcmp(argv[1], "alt") == 0)
+        {   field = t_deadband::ALT;   }
+        else if (strcmp(argv[1], "spd") == 0)
+        {   field = t_deadband::SPEED;   }
+        else if (strcmp(argv[1], "crs") == 0)
+        {   field = t_deadband::COURSE;   }
+        else if (strcmp(argv[1], "hdop") == 0)
+        {   field = t_deadband::HDOP;   }
+        else if (strcmp(argv[1], "snr") == 0)
+        {   field = t_deadband::SNR;   }
+        else
+        {   return false;   }
+
+        int32_t value = 0;
+        if ( (parse_fixed(argv[2], strlen(argv[2]), 2U, &value) == false) ||
+             (value < 0) )
+        {   return false;   }
+        set_deadband(field, (uint32_t)(value));
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @details Getter method to return the LINE framing (the sentences end with
+ * CR LF, and the CR is dropped by the decoder).
+ */
+void UARTNmea::get_framing(t_framing* framing, uint32_t* param)
+{
+    *framing = t_framing::LINE;
+    *param = (uint32_t)('\n');
+}
+
+/**
+ * @details Getter method to return if the raw lines are published too.
+ */
+bool UARTNmea::pass_raw()
+{
+    return raw;
+}
+
+/**
+ * @details This function decodes the line, and emits the record of the
+ * previous epoch as JSON text on the decoder topic if the line started a new
+ * one with changes.
+ */
+void UARTNmea::feed(const uint8_t* data, const uint32_t len,
+        const int64_t t_us)
+{
+    if (decode(data, len, t_us))
+    {   emit(nullptr, (const uint8_t*)(record), record_len);   }
+}
+
+/**
+ * @details This function emits the record of the current epoch when no
+ * sentence has been received for the epoch end silence (at the Port speed).
+ */
+void UARTNmea::flush(const int64_t t_now_us)
+{
+    if (poll(t_now_us, EPOCH_GAP_CHARS * char_time_us))
+    {   emit(nullptr, (const uint8_t*)(record), record_len);   }
+}
+
+/**
+ * @details Setter method to configure the deadband of a field.
+ */
+void UARTNmea::set_deadband(const t_deadband field, const uint32_t value)
+{
+    if (field >= t_deadband::NUM)
+    {   return;   }
+
+    deadband[(uint8_t)(field)] = value;
+}
+
+/**
+ * @details Getter method to return the deadband of a field.
+ */
+uint32_t UARTNmea::get_deadband(const t_deadband field)
+{
+    if (field >= t_deadband::NUM)
+    {   return 0U;   }
+
+    return deadband[(uint8_t)(field)];
+}
+
+/**
+ * @details The number is an optional sign, digits and an optional decimal
+ * point. The decimals beyond the requested ones are truncated, and missing
+ * ones are filled with zeros.
+ */
+bool UARTNmea::parse_fixed(const char* str, const uint32_t len,
+        const uint8_t decimals, int32_t* value)
+{
+    if ( (str == nullptr) || (len == 0U) )
+    {   return false;   }
+
+    uint32_t i = 0U;
+    bool negative = false;
+    if ( (str[0] == '-') || (str[0] == '+') )
+    {
+        negative = (str[0] == '-');
+        i = 1U;
+    }
+
+    int64_t result = 0;
+    uint8_t num_decimals = 0U;
+    bool has_point = false;
+    bool has_digits = false;
+    for (; i < len; i++)
+    {
+        char c = str[i];
+        if (c == '.')
+        {
+            if (has_point)
+            {   return false;   }
+            has_point = true;
+            continue;
+        }
+        if ( (c < '0') || (c > '9') )
+        {   return false;   }
+        has_digits = true;
+        if (has_point)
+        {
+            if (num_decimals >= decimals)
+            {   continue;   }
+            num_decimals = num_decimals + 1U;
+        }
+        result = (result * 10) + (int64_t)(c - '0');
+        if (result > INT32_MAX)
+        {   return false;   }
+    }
+    if (has_digits == false)
+    {   return false;   }
+
+    for (; num_decimals < decimals; num_decimals++)
+    {
+        result = result * 10;
+        if (result > INT32_MAX)
+        {   return false;   }
+    }
+
+    *value = (negative) ? (int32_t)(-result) : (int32_t)(result);
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details The sentence is taken from its "$" (any previous noise is
+ * skipped) to its "*hh" checksum (line end characters are ignored), and the
+ * checksum (XOR of the characters between them) is checked. The GGA, RMC,
+ * VTG and GSV sentences are parsed and merged into the current fix, other
+ * valid sentences (i.e. GSA or proprietary ones) are ignored.
+ */
+bool UARTNmea::decode(const uint8_t* line, const uint32_t len,
+        const int64_t t_us)
+{
+    const char* str = (const char*)(line);
+
+    // Find the sentence start and drop the line end
+    uint32_t start = 0U;
+    while ( (start < len) && (str[start] != '$') )
+    {   start = start + 1U;   }
+    uint32_t end = len;
+    while ( (end > start) && ( (str[end - 1U] == '\r') ||
+            (str[end - 1U] == '\n') || (str[end - 1U] == ' ') ) )
+    {   end = end - 1U;   }
+
+    // Check the format ("$", address, fields and "*hh")
+    if ( (end - start < 9U) || (str[end - 3U] != '*') )
+    {
+        num_errors = num_errors + 1U;
+        return false;
+    }
+    int8_t hi = hex_value(str[end - 2U]);
+    int8_t lo = hex_value(str[end - 1U]);
+    if ( (hi < 0) || (lo < 0) )
+    {
+        num_errors = num_errors + 1U;
+        return false;
+    }
+
+    // Check the checksum
+    uint8_t checksum = 0U;
+    for (uint32_t i = start + 1U; i < end - 3U; i++)
+    {   checksum = checksum ^ (uint8_t)(str[i]);   }
+    if (checksum != (uint8_t)((hi << 4) | lo))
+    {
+        num_errors = num_errors + 1U;
+        return false;
+    }
+
+    // Ignore the sentences without a talker ID and type address
+    split_fields(&(str[start + 1U]), end - 3U - (start + 1U));
+    if ( (num_fields == 0U) || (field_len[0] != 5U) )
+    {   return false;   }
+    char talker = field[0][1];
+    const char* type = &(field[0][2]);
+
+    bool record_ready = false;
+    if (memcmp(type, "GGA", 3U) == 0)
+    {
+        s_gga gga;
+        if (parse_gga(&gga) == false)
+        {
+            num_errors = num_errors + 1U;
+            return false;
+        }
+
+        if (gga.has_time)
+        {
+            record_ready = epoch_start(gga.time_ms);
+            fix.time_ms = gga.time_ms;
+            fix.fields = fix.fields | FIELD_TIME;
+        }
+        fix.quality = gga.quality;
+        fix.num_sats = gga.num_sats;
+        fix.fields = fix.fields | FIELD_QUALITY | FIELD_SATS;
+        if (gga.has_pos)
+        {
+            fix.lat = gga.lat;
+            fix.lon = gga.lon;
+            fix.fields = fix.fields | FIELD_POS;
+        }
+        if (gga.has_alt)
+        {
+            fix.alt = gga.alt;
+            fix.fields = fix.fields | FIELD_ALT;
+        }
+        if (gga.has_hdop)
+        {
+            fix.hdop = gga.hdop;
+            fix.fields = fix.fields | FIELD_HDOP;
+        }
+    }
+    else if (memcmp(type, "RMC", 3U) == 0)
+    {
+        s_rmc rmc;
+        if (parse_rmc(&rmc) == false)
+        {
+            num_errors = num_errors + 1U;
+            return false;
+        }
+
+        if (rmc.has_time)
+        {
+            record_ready = epoch_start(rmc.time_ms);
+            fix.time_ms = rmc.time_ms;
+            fix.fields = fix.fields | FIELD_TIME;
+        }
+        fix.valid = rmc.valid;
+        fix.fields = fix.fields | FIELD_VALID;
+        if (rmc.has_date)
+        {
+            fix.date = rmc.date;
+            fix.fields = fix.fields | FIELD_DATE;
+        }
+        if (rmc.has_pos)
+        {
+            fix.lat = rmc.lat;
+            fix.lon = rmc.lon;
+            fix.fields = fix.fields | FIELD_POS;
+        }
+        if (rmc.has_speed)
+        {
+            fix.speed = rmc.speed;
+            fix.fields = fix.fields | FIELD_SPEED;
+        }
+        if (rmc.has_course)
+        {
+            fix.course = rmc.course;
+            fix.fields = fix.fields | FIELD_COURSE;
+        }
+    }
+    else if (memcmp(type, "VTG", 3U) == 0)
+    {
+        s_vtg vtg;
+        if (parse_vtg(&vtg) == false)
+        {
+            num_errors = num_errors + 1U;
+            return false;
+        }
+
+        if (vtg.has_speed)
+        {
+            fix.speed = vtg.speed;
+            fix.fields = fix.fields | FIELD_SPEED;
+        }
+        if (vtg.has_course)
+        {
+            fix.course = vtg.course;
+            fix.fields = fix.fields | FIELD_COURSE;
+        }
+    }
+    else if (memcmp(type, "GSV", 3U) == 0)
+    {
+        s_gsv gsv;
+        if (parse_gsv(&gsv) == false)
+        {
+            num_errors = num_errors + 1U;
+            return false;
+        }
+
+        merge_gsv(talker, &gsv);
+    }
+    else
+    {   return false;   }
+
+    epoch_pending = true;
+    t_last_us = t_us;
+
+    return record_ready;
+}
+
+/**
+ * @details This function completes the current epoch if no sentence has
+ * been received during the time gap (the receiver sends all the sentences
+ * of an epoch back to back, so the last epoch doesn't have to wait for the
+ * next one to be published).
+ */
+bool UARTNmea::poll(const int64_t t_now_us, const uint32_t gap_us)
+{
+    // Do nothing if there is no epoch in progress
+    if (epoch_pending == false)
+    {   return false;   }
+
+    // Do nothing if more sentences of the epoch can still arrive
+    if (t_now_us - t_last_us < (int64_t)(gap_us))
+    {   return false;   }
+
+    return build_record();
+}
+
+/**
+ * @details The fields point to the sentence data (they are not copied), and
+ * the fields beyond the maximum are ignored.
+ */
+void UARTNmea::split_fields(const char* str, const uint32_t len)
+{
+    uint32_t field_start = 0U;
+    num_fields = 0U;
+    for (uint32_t i = 0U; i <= len; i++)
+    {
+        if ( (i < len) && (str[i] != ',') )
+        {   continue;   }
+
+        if (num_fields < MAX_FIELDS)
+        {
+            uint32_t flen = i - field_start;
+            field[num_fields] = &(str[field_start]);
+            field_len[num_fields] = (flen > UINT8_MAX) ?
+                (uint8_t)(UINT8_MAX) : (uint8_t)(flen);
+            num_fields = num_fields + 1U;
+        }
+        field_start = i + 1U;
+    }
+}
+
+/**
+ * @details This function parses a field if the sentence has it.
+ */
+bool UARTNmea::field_fixed(const uint8_t i, const uint8_t decimals,
+        int32_t* value)
+{
+    if (i >= num_fields)
+    {   return false;   }
+
+    return parse_fixed(field[i], field_len[i], decimals, value);
+}
+
+/**
+ * @details The time is parsed with 3 decimals (hhmmss000 + ms) and then
+ * converted to ms of the day.
+ */
+bool UARTNmea::field_time(const uint8_t i, uint32_t* time_ms)
+{
+    int32_t value = 0;
+    if ( (i >= num_fields) || (field_len[i] < 6U) ||
+         (field_fixed(i, 3U, &value) == false) || (value < 0) )
+    {   return false;   }
+
+    uint32_t hhmmss = (uint32_t)(value) / 1000U;
+    uint32_t h = hhmmss / 10000U;
+    uint32_t m = (hhmmss / 100U) % 100U;
+    uint32_t s = hhmmss % 100U;
+    if ( (h > 23U) || (m > 59U) || (s > 60U) )
+    {   return false;   }
+
+    *time_ms = (((((h * 60U) + m) * 60U) + s) * 1000U) +
+        ((uint32_t)(value) % 1000U);
+    return true;
+}
+
+/**
+ * @details The coordinate is parsed with 5 decimals of minutes (dddmm00000
+ * + minutes), and the minutes are converted to 1e-7 degrees (x 100 / 60).
+ */
+bool UARTNmea::field_coord(const uint8_t i, int32_t* coord)
+{
+    int32_t value = 0;
+    if ( (i + 1U >= num_fields) || (field_len[i + 1U] != 1U) ||
+         (field_fixed(i, 5U, &value) == false) || (value < 0) )
+    {   return false;   }
+
+    int64_t degrees = (int64_t)(value) / 10000000;
+    int64_t minutes = (int64_t)(value) % 10000000;
+    if ( (degrees > 180) || (minutes >= 6000000) )
+    {   return false;   }
+
+    int64_t result = (degrees * 10000000) + ((minutes * 5) / 3);
+    char hemisphere = field[i + 1U][0];
+    if ( (hemisphere == 'S') || (hemisphere == 'W') )
+    {   result = -result;   }
+    else if ( (hemisphere != 'N') && (hemisphere != 'E') )
+    {   return false;   }
+
+    *coord = (int32_t)(result);
+    return true;
+}
+
+/**
+ * @details Getter method to return the value of an hexadecimal digit (upper
+ * or lower case).
+ */
+int8_t UARTNmea::hex_value(const char c)
+{
+    if ( (c >= '0') && (c <= '9') )
+    {   return (int8_t)(c - '0');   }
+    if ( (c >= 'A') && (c <= 'F') )
+    {   return (int8_t)(c - 'A' + 10);   }
+    if ( (c >= 'a') && (c <= 'f') )
+    {   return (int8_t)(c - 'a' + 10);   }
+    return -1;
+}
+
+/**
+ * @details The sentences of an epoch share the UTC time, so a different time
+ * (or the first time after sentences without it) starts a new epoch.
+ */
+bool UARTNmea::epoch_start(const uint32_t time_ms)
+{
+    if (epoch_pending == false)
+    {   return false;   }
+
+    if ( ((fix.fields & FIELD_TIME) != 0U) && (fix.time_ms == time_ms) )
+    {   return false;   }
+
+    return build_record();
+}
+
+/**
+ * @details GGA: time, latitude, N/S, longitude, E/W, quality, satellites,
+ * HDOP, altitude, "M", ... The quality is required, the rest of the fields
+ * are empty without fix.
+ */
+bool UARTNmea::parse_gga(s_gga* gga)
+{
+    int32_t value = 0;
+
+    memset((void*)(gga), 0, sizeof(s_gga));
+    if (num_fields < 10U)
+    {   return false;   }
+
+    if ( (field_fixed(6U, 0U, &value) == false) || (value < 0) ||
+         (value > 9) )
+    {   return false;   }
+    gga->quality = (uint8_t)(value);
+
+    gga->has_time = field_time(1U, &(gga->time_ms));
+    gga->has_pos = field_coord(2U, &(gga->lat)) &&
+        field_coord(4U, &(gga->lon));
+    if ( field_fixed(7U, 0U, &value) && (value >= 0) && (value <= 255) )
+    {   gga->num_sats = (uint8_t)(value);   }
+    if ( field_fixed(8U, 2U, &value) && (value >= 0) && (value <= 65535) )
+    {
+        gga->hdop = (uint16_t)(value);
+        gga->has_hdop = true;
+    }
+    gga->has_alt = field_fixed(9U, 2U, &(gga->alt));
+
+    return true;
+}
+
+/**
+ * @details RMC: time, status (A: valid, V: warning), latitude, N/S,
+ * longitude, E/W, speed (knots), course (degrees true), date (ddmmyy), ...
+ * The status is required.
+ */
+bool UARTNmea::parse_rmc(s_rmc* rmc)
+{
+    int32_t value = 0;
+
+    memset((void*)(rmc), 0, sizeof(s_rmc));
+    if ( (num_fields < 10U) || (field_len[2] != 1U) )
+    {   return false;   }
+
+    if (field[2][0] == 'A')
+    {   rmc->valid = true;   }
+    else if (field[2][0] != 'V')
+    {   return false;   }
+
+    rmc->has_time = field_time(1U, &(rmc->time_ms));
+    rmc->has_pos = field_coord(3U, &(rmc->lat)) &&
+        field_coord(5U, &(rmc->lon));
+    if ( field_fixed(7U, 2U, &value) && (value >= 0) )
+    {
+        rmc->speed = (uint32_t)(value);
+        rmc->has_speed = true;
+    }
+    if ( field_fixed(8U, 2U, &value) && (value >= 0) )
+    {
+        rmc->course = (uint32_t)(value);
+        rmc->has_course = true;
+    }
+    if ( (field_len[9] == 6U) && field_fixed(9U, 0U, &value) &&
+         (value >= 0) )
+    {
+        rmc->date = (uint32_t)(value);
+        rmc->has_date = true;
+    }
+
+    return true;
+}
+
+/**
+ * @details VTG: course (degrees true), "T", course (degrees magnetic), "M",
+ * speed (knots), "N", speed (km/h), "K", ...
+ */
+bool UARTNmea::parse_vtg(s_vtg* vtg)
+{
+    int32_t value = 0;
+
+    memset((void*)(vtg), 0, sizeof(s_vtg));
+    if (num_fields < 8U)
+    {   return false;   }
+
+    if ( field_fixed(1U, 2U, &value) && (value >= 0) )
+    {
+        vtg->course = (uint32_t)(value);
+        vtg->has_course = true;
+    }
+    if ( field_fixed(5U, 2U, &value) && (value >= 0) )
+    {
+        vtg->speed = (uint32_t)(value);
+        vtg->has_speed = true;
+    }
+
+    return true;
+}
+
+/**
+ * @details GSV: number of messages, message number, satellites in view,
+ * and up to 4 groups of PRN, elevation, azimuth and SNR (empty if the
+ * satellite is not tracked), optionally followed by the signal ID (NMEA
+ * 4.11, ignored).
+ */
+bool UARTNmea::parse_gsv(s_gsv* gsv)
+{
+    int32_t value = 0;
+
+    memset((void*)(gsv), 0, sizeof(s_gsv));
+    if (num_fields < 4U)
+    {   return false;   }
+
+    if ( (field_fixed(1U, 0U, &value) == false) || (value < 1) ||
+         (value > 9) )
+    {   return false;   }
+    gsv->num_msgs = (uint8_t)(value);
+    if ( (field_fixed(2U, 0U, &value) == false) || (value < 1) ||
+         (value > (int32_t)(gsv->num_msgs)) )
+    {   return false;   }
+    gsv->msg_n = (uint8_t)(value);
+    if ( (field_fixed(3U, 0U, &value) == false) || (value < 0) ||
+         (value > 255) )
+    {   return false;   }
+    gsv->num_view = (uint8_t)(value);
+
+    for (uint8_t base = 4U; (base + 3U < num_fields) &&
+            (gsv->num_sats < GSV_SATS); base = base + 4U)
+    {
+        uint8_t n = gsv->num_sats;
+        if ( (field_fixed(base, 0U, &value) == false) || (value < 0) ||
+             (value > 255) )
+        {   continue;   }
+        gsv->prn[n] = (uint8_t)(value);
+        gsv->snr[n] = 0U;
+        if ( field_fixed(base + 3U, 0U, &value) && (value > 0) &&
+             (value <= 99) )
+        {   gsv->snr[n] = (uint8_t)(value);   }
+        gsv->num_sats = n + 1U;
+    }
+
+    return true;
+}
+
+/**
+ * @details Each talker (constellation) sends its own sequence of GSV
+ * sentences. The tracked satellites of the sequence are accumulated, and
+ * when its last sentence arrives the talker satellites in view are
+ * replaced. The fix has the satellites in view of all the talkers and their
+ * mean SNR. A sequence with a missing sentence is discarded.
+ */
+void UARTNmea::merge_gsv(const char talker, const s_gsv* gsv)
+{
+    uint8_t t = 0U;
+    switch (talker)
+    {
+        case 'L':
+            t = 1U;
+            break;
+        case 'A':
+            t = 2U;
+            break;
+        case 'B':
+        case 'D':
+            t = 3U;
+            break;
+        case 'Q':
+            t = 4U;
+            break;
+        default:
+            t = 0U;
+            break;
+    }
+
+    s_sky* rx = &(sky_rx[t]);
+    if (gsv->msg_n == 1U)
+    {
+        rx->num_tracked = 0U;
+        rx->snr_sum = 0U;
+        rx->next_msg = 1U;
+    }
+    if (gsv->msg_n != rx->next_msg)
+    {
+        rx->next_msg = 0U;
+        return;
+    }
+    rx->next_msg = rx->next_msg + 1U;
+
+    for (uint8_t i = 0U; i < gsv->num_sats; i++)
+    {
+        if (gsv->snr[i] == 0U)
+        {   continue;   }
+        rx->num_tracked = rx->num_tracked + 1U;
+        rx->snr_sum = rx->snr_sum + gsv->snr[i];
+    }
+
+    // Wait for the rest of the sequence
+    if (gsv->msg_n != gsv->num_msgs)
+    {   return;   }
+
+    rx->num_view = gsv->num_view;
+    rx->next_msg = 0U;
+    sky[t] = *rx;
+
+    uint32_t num_view = 0U;
+    uint32_t num_tracked = 0U;
+    uint32_t snr_sum = 0U;
+    for (uint8_t i = 0U; i < MAX_TALKERS; i++)
+    {
+        num_view = num_view + sky[i].num_view;
+        num_tracked = num_tracked + sky[i].num_tracked;
+        snr_sum = snr_sum + sky[i].snr_sum;
+    }
+    fix.num_view = (num_view > UINT8_MAX) ?
+        (uint8_t)(UINT8_MAX) : (uint8_t)(num_view);
+    fix.snr = 0U;
+    if (num_tracked > 0U)
+    {   fix.snr = (uint16_t)((snr_sum * 100U) / num_tracked);   }
+    fix.fields = fix.fields | FIELD_VIEW | FIELD_SNR;
+}
+
+/**
+ * @details The discrete fields (date, status, quality and satellites) are
+ * published on any change, and the measures when they move beyond their
+ * deadband from the last published value (so a slow drift is published
+ * when it accumulates). The position deadband is a distance (an
+ * equirectangular approximation is enough for a few meters). The UTC time
+ * is included in every record as its reference. The published values are
+ * only updated for the fields in the record.
+ */
+bool UARTNmea::build_record()
+{
+    epoch_pending = false;
+
+    uint16_t both = fix.fields & published.fields;
+    uint16_t changed = fix.fields & (uint16_t)(~published.fields) &
+        (uint16_t)(~FIELD_TIME);
+
+    // Discrete fields
+    if ( ((both & FIELD_DATE) != 0U) && (fix.date != published.date) )
+    {   changed = changed | FIELD_DATE;   }
+    if ( ((both & FIELD_VALID) != 0U) && (fix.valid != published.valid) )
+    {   changed = changed | FIELD_VALID;   }
+    if ( ((both & FIELD_QUALITY) != 0U) &&
+         (fix.quality != published.quality) )
+    {   changed = changed | FIELD_QUALITY;   }
+    if ( ((both & FIELD_SATS) != 0U) &&
+         (fix.num_sats != published.num_sats) )
+    {   changed = changed | FIELD_SATS;   }
+    if ( ((both & FIELD_VIEW) != 0U) &&
+         (fix.num_view != published.num_view) )
+    {   changed = changed | FIELD_VIEW;   }
+
+    // Position (1e-7 degrees of latitude are 1.1132 cm)
+    if ((both & FIELD_POS) != 0U)
+    {
+        float lat_rad = (float)(fix.lat) * 1.7453293e-9f;
+        float dy = (float)((int64_t)(fix.lat) - (int64_t)(published.lat)) *
+            1.1132f;
+        float dx = (float)((int64_t)(fix.lon) - (int64_t)(published.lon)) *
+            1.1132f * cosf(lat_rad);
+        float db = (float)(deadband[(uint8_t)(t_deadband::POS)]);
+        if ((dx * dx) + (dy * dy) > db * db)
+        {   changed = changed | FIELD_POS;   }
+    }
+
+    // Measures
+    if ( ((both & FIELD_ALT) != 0U) &&
+         exceeds(fix.alt, published.alt, t_deadband::ALT) )
+    {   changed = changed | FIELD_ALT;   }
+    if ( ((both & FIELD_HDOP) != 0U) &&
+         exceeds(fix.hdop, published.hdop, t_deadband::HDOP) )
+    {   changed = changed | FIELD_HDOP;   }
+    if ( ((both & FIELD_SPEED) != 0U) &&
+         exceeds((int32_t)(fix.speed), (int32_t)(published.speed),
+            t_deadband::SPEED) )
+    {   changed = changed | FIELD_SPEED;   }
+    if ( ((both & FIELD_SNR) != 0U) &&
+         exceeds(fix.snr, published.snr, t_deadband::SNR) )
+    {   changed = changed | FIELD_SNR;   }
+    if ((both & FIELD_COURSE) != 0U)
+    {
+        uint32_t diff = (fix.course > published.course) ?
+            (fix.course - published.course) : (published.course - fix.course);
+        diff = diff % 36000U;
+        if (diff > 18000U)
+        {   diff = 36000U - diff;   }
+        if (diff > deadband[(uint8_t)(t_deadband::COURSE)])
+        {   changed = changed | FIELD_COURSE;   }
+    }
+
+    // Do nothing if nothing changed
+    if (changed == 0U)
+    {   return false;   }
+
+    record[0] = '{';
+    record[1] = '\0';
+    record_len = 1U;
+    if ((fix.fields & FIELD_TIME) != 0U)
+    {
+        uint32_t s = fix.time_ms / 1000U;
+        record_advance(snprintf(&(record[record_len]),
+            MAX_RECORD_LEN - record_len,
+            "\"utc\":\"%02u:%02u:%02u.%03u\"",
+            (unsigned)(s / 3600U), (unsigned)((s / 60U) % 60U),
+            (unsigned)(s % 60U), (unsigned)(fix.time_ms % 1000U)));
+        published.time_ms = fix.time_ms;
+    }
+    if ((changed & FIELD_DATE) != 0U)
+    {
+        record_advance(snprintf(&(record[record_len]),
+            MAX_RECORD_LEN - record_len, "%s\"date\":\"20%02u-%02u-%02u\"",
+            (record_len > 1U) ? "," : "", (unsigned)(fix.date % 100U),
+            (unsigned)((fix.date / 100U) % 100U),
+            (unsigned)(fix.date / 10000U)));
+        published.date = fix.date;
+    }
+    if ((changed & FIELD_VALID) != 0U)
+    {
+        append_field("valid", (fix.valid) ? 1 : 0, 0U);
+        published.valid = fix.valid;
+    }
+    if ((changed & FIELD_QUALITY) != 0U)
+    {
+        append_field("fix", fix.quality, 0U);
+        published.quality = fix.quality;
+    }
+    if ((changed & FIELD_POS) != 0U)
+    {
+        append_field("lat", fix.lat, 7U);
+        append_field("lon", fix.lon, 7U);
+        published.lat = fix.lat;
+        published.lon = fix.lon;
+    }
+    if ((changed & FIELD_ALT) != 0U)
+    {
+        append_field("alt", fix.alt, 2U);
+        published.alt = fix.alt;
+    }
+    if ((changed & FIELD_SATS) != 0U)
+    {
+        append_field("sats", fix.num_sats, 0U);
+        published.num_sats = fix.num_sats;
+    }
+    if ((changed & FIELD_HDOP) != 0U)
+    {
+        append_field("hdop", fix.hdop, 2U);
+        published.hdop = fix.hdop;
+    }
+    if ((changed & FIELD_SPEED) != 0U)
+    {
+        append_field("spd", fix.speed, 2U);
+        published.speed = fix.speed;
+    }
+    if ((changed & FIELD_COURSE) != 0U)
+    {
+        append_field("crs", fix.course, 2U);
+        published.course = fix.course;
+    }
+    if ((changed & FIELD_VIEW) != 0U)
+    {
+        append_field("view", fix.num_view, 0U);
+        published.num_view = fix.num_view;
+    }
+    if ((changed & FIELD_SNR) != 0U)
+    {
+        append_field("snr", fix.snr, 2U);
+        published.snr = fix.snr;
+    }
+    record_advance(snprintf(&(record[record_len]),
+        MAX_RECORD_LEN - record_len, "}"));
+    published.fields = published.fields | changed |
+        (fix.fields & FIELD_TIME);
+
+    return true;
+}
+
+/**
+ * @details This function appends the field as a JSON number with its
+ * decimals (preceded by a comma if it is not the first one).
+ */
+void UARTNmea::append_field(const char* key, const int64_t value,
+        const uint8_t decimals)
+{
+    uint64_t scale = 1U;
+    for (uint8_t i = 0U; i < decimals; i++)
+    {   scale = scale * 10U;   }
+    uint64_t abs_value = (value < 0) ? (uint64_t)(-value) : (uint64_t)(value);
+    const char* sep = (record_len > 1U) ? "," : "";
+    const char* sign = (value < 0) ? "-" : "";
+
+    if (decimals == 0U)
+    {
+        record_advance(snprintf(&(record[record_len]),
+            MAX_RECORD_LEN - record_len, "%s\"%s\":%s%llu", sep, key, sign,
+            (unsigned long long)(abs_value)));
+    }
+    else
+    {
+        record_advance(snprintf(&(record[record_len]),
+            MAX_RECORD_LEN - record_len, "%s\"%s\":%s%llu.%0*llu", sep, key,
+            sign, (unsigned long long)(abs_value / scale), (int)(decimals),
+            (unsigned long long)(abs_value % scale)));
+    }
+}
+
+/**
+ * @details This function advances the record length, limiting it to the
+ * record buffer (snprintf() has already truncated the text).
+ */
+void UARTNmea::record_advance(const int n)
+{
+    if (n < 0)
+    {   return;   }
+
+    record_len = record_len + (uint32_t)(n);
+    if (record_len >= MAX_RECORD_LEN)
+    {   record_len = MAX_RECORD_LEN - 1U;   }
+}
+
+/**
+ * @details The difference is taken in 64 bits, so it never overflows.
+ */
+bool UARTNmea::exceeds(const int32_t value, const int32_t last,
+        const t_deadband field)
+{
+    int64_t diff = (int64_t)(value) - (int64_t)(last);
+    if (diff < 0)
+    {   diff = -diff;   }
+
+    return (diff > (int64_t)(deadband[(uint8_t)(field)]));
+}
+
+/*****************************************************************************/
@@ -0,0 +1,552 @@
+/**
+ * @file    uart_nmea.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART NMEA 0183 decoder header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_NMEA_H
+#define UART_NMEA_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+// UART Protocol Decoders Framework
+#include "uart_decoder.h"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief NMEA 0183 sentences decoder. Each received line is validated with
+ * its "*hh" checksum, and the GGA, RMC, VTG and GSV sentences (of any
+ * talker) are parsed into fixed structs and merged into the current fix.
+ * The fix of each epoch (the sentences that share the same UTC time) is
+ * compared with the last published values, and a record with only the
+ * fields that changed beyond their deadbands is built:
+ * {"utc":"hh:mm:ss.sss","lat":D,"lon":D,"alt":M,...}
+ * All the values are integers internally (fixed point), so the decoding
+ * doesn't depend on the float parsing of the C library.
+ */
+class UARTNmea : public UARTDecoder
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+    public:
+
+        /**
+         * @brief Decoder name.
+         */
+        static constexpr char NAME[] = "nmea";
+
+        /**
+         * @brief Epoch end silence (characters, a bit more than a full
+         * sentence, as the receiver sends all the sentences of an epoch
+         * back to back).
+         */
+        static constexpr uint32_t EPOCH_GAP_CHARS = 100U;
+
+        /**
+         * @brief Maximum length of a record.
+         */
+        static constexpr uint32_t MAX_RECORD_LEN = 256U;
+
+        /**
+         * @brief Number of satellites of a GSV sentence.
+         */
+        static constexpr uint8_t GSV_SATS = 4U;
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Maximum number of fields of a sentence (GSV with 4
+         * satellites and signal ID).
+         */
+        static constexpr uint8_t MAX_FIELDS = 24U;
+
+        /**
+         * @brief Maximum number of GSV talkers tracked (GP, GL, GA, GB/BD
+         * and GQ).
+         */
+        static constexpr uint8_t MAX_TALKERS = 5U;
+
+        /**
+         * @brief Fix fields (bits of the known and changed fields masks).
+         */
+        static constexpr uint16_t FIELD_TIME = 0x0001U;
+        static constexpr uint16_t FIELD_DATE = 0x0002U;
+        static constexpr uint16_t FIELD_VALID = 0x0004U;
+        static constexpr uint16_t FIELD_QUALITY = 0x0008U;
+        static constexpr uint16_t FIELD_POS = 0x0010U;
+        static constexpr uint16_t FIELD_ALT = 0x0020U;
+        static constexpr uint16_t FIELD_SATS = 0x0040U;
+        static constexpr uint16_t FIELD_HDOP = 0x0080U;
+        static constexpr uint16_t FIELD_SPEED = 0x0100U;
+        static constexpr uint16_t FIELD_COURSE = 0x0200U;
+        static constexpr uint16_t FIELD_VIEW = 0x0400U;
+        static constexpr uint16_t FIELD_SNR = 0x0800U;
+
+    /******************************************************************/
+
+    /* Public Data Types */
+
+    public:
+
+        /**
+         * @brief Fields with a configurable deadband (in hundredths of
+         * their unit: meters, meters, knots, degrees, HDOP and dB).
+         */
+        enum class t_deadband : uint8_t
+        {
+            POS = 0,
+            ALT = 1,
+            SPEED = 2,
+            COURSE = 3,
+            HDOP = 4,
+            SNR = 5,
+            NUM = 6
+        };
+
+        /**
+         * @brief GGA sentence (fix data). Time in ms of the day,
+         * coordinates in 1e-7 degrees, altitude in cm, HDOP x100.
+         */
+        struct s_gga
+        {
+            uint32_t time_ms;
+            int32_t lat;
+            int32_t lon;
+            int32_t alt;
+            uint16_t hdop;
+            uint8_t quality;
+            uint8_t num_sats;
+            bool has_time;
+            bool has_pos;
+            bool has_alt;
+            bool has_hdop;
+        };
+
+        /**
+         * @brief RMC sentence (recommended minimum data). Time in ms of the
+         * day, date as ddmmyy, coordinates in 1e-7 degrees, speed in
+         * knots x100, course in degrees x100.
+         */
+        struct s_rmc
+        {
+            uint32_t time_ms;
+            uint32_t date;
+            int32_t lat;
+            int32_t lon;
+            uint32_t speed;
+            uint32_t course;
+            bool valid;
+            bool has_time;
+            bool has_date;
+            bool has_pos;
+            bool has_speed;
+            bool has_course;
+        };
+
+        /**
+         * @brief VTG sentence (course and speed). Speed in knots x100,
+         * course in degrees x100.
+         */
+        struct s_vtg
+        {
+            uint32_t speed;
+            uint32_t course;
+            bool has_speed;
+            bool has_course;
+        };
+
+        /**
+         * @brief GSV sentence (satellites in view, one of a sequence). SNR
+         * in dB (0: not tracked).
+         */
+        struct s_gsv
+        {
+            uint8_t num_msgs;
+            uint8_t msg_n;
+            uint8_t num_view;
+            uint8_t num_sats;
+            uint8_t prn[GSV_SATS];
+            uint8_t snr[GSV_SATS];
+        };
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+    private:
+
+        /**
+         * @brief Merged fix data (same units as the sentences, mean SNR in
+         * dB x100).
+         */
+        struct s_fix
+        {
+            uint32_t time_ms;
+            uint32_t date;
+            int32_t lat;
+            int32_t lon;
+            int32_t alt;
+            uint32_t speed;
+            uint32_t course;
+            uint16_t hdop;
+            uint16_t snr;
+            uint8_t quality;
+            uint8_t num_sats;
+            uint8_t num_view;
+            bool valid;
+            uint16_t fields;
+        };
+
+        /**
+         * @brief Satellites in view of a talker.
+         */
+        struct s_sky
+        {
+            uint8_t num_view;
+            uint8_t num_tracked;
+            uint16_t snr_sum;
+            uint8_t next_msg;
+        };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new NMEA decoder object.
+         */
+        UARTNmea();
+
+        /**
+         * @brief Configure the decoder options: raw <on|off> (publish the
+         * raw lines too) or db <pos|alt|spd|crs|hdop|snr> <value> (field
+         * deadband, in its unit).
+         * @param argc Number of option arguments.
+         * @param argv Option arguments.
+         * @return true Configuration success.
+         * @return false Unknown or invalid option.
+         */
+        bool configure(int argc, char* argv[]) override;
+
+        /**
+         * @brief Get the Rx framing required by the decoder (LINE framing,
+         * sentences end with CR LF).
+         * @param framing Framing mode.
+         * @param param Framing mode parameter.
+         */
+        void get_framing(t_framing* framing, uint32_t* param) override;
+
+        /**
+         * @brief Check if the raw lines must be published too.
+         * @return true Publish the lines.
+         * @return false Only the records are published.
+         */
+        bool pass_raw() override;
+
+        /**
+         * @brief Feed a Rx line, emitting the record of the previous epoch
+         * if the line starts a new one with changes.
+         * @param data Line data.
+         * @param len Line length.
+         * @param t_us Line reception time (us).
+         */
+        void feed(const uint8_t* data, const uint32_t len,
+                const int64_t t_us) override;
+
+        /**
+         * @brief Emit the record of the current epoch if no sentence has
+         * been received for the epoch end silence.
+         * @param t_now_us Current time (us).
+         */
+        void flush(const int64_t t_now_us) override;
+
+        /**
+         * @brief Set the deadband of a field.
+         * @param field Field.
+         * @param value Deadband (hundredths of the field unit).
+         */
+        void set_deadband(const t_deadband field, const uint32_t value);
+
+        /**
+         * @brief Get the deadband of a field.
+         * @param field Field.
+         * @return uint32_t Deadband (hundredths of the field unit).
+         */
+        uint32_t get_deadband(const t_deadband field);
+
+        /**
+         * @brief Parse a decimal number as a fixed point integer (extra
+         * decimals are truncated).
+         * @param str Number string.
+         * @param len Number string length.
+         * @param decimals Number of decimals of the result.
+         * @param value Result (number x 10^decimals).
+         * @return true Number parsed.
+         * @return false Empty or invalid number.
+         */
+        static bool parse_fixed(const char* str, const uint32_t len,
+                const uint8_t decimals, int32_t* value);
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Decode a received line. A sentence with a new UTC time
+         * completes the record of the previous epoch first.
+         * @param line Line data.
+         * @param len Line length.
+         * @param t_us Line reception time (us).
+         * @return true A record is ready.
+         * @return false No record.
+         */
+        bool decode(const uint8_t* line, const uint32_t len,
+                const int64_t t_us);
+
+        /**
+         * @brief Check if the current epoch has ended (no sentence received
+         * in a time gap), completing its record.
+         * @param t_now_us Current time (us).
+         * @param gap_us Epoch end time gap (us).
+         * @return true A record is ready.
+         * @return false No record.
+         */
+        bool poll(const int64_t t_now_us, const uint32_t gap_us);
+
+        /**
+         * @brief Split a sentence (between "$" and "*") into fields.
+         * @param str Sentence.
+         * @param len Sentence length.
+         */
+        void split_fields(const char* str, const uint32_t len);
+
+        /**
+         * @brief Parse a field as a fixed point integer.
+         * @param i Field index.
+         * @param decimals Number of decimals of the result.
+         * @param value Result.
+         * @return true Field parsed.
+         * @return false Missing, empty or invalid field.
+         */
+        bool field_fixed(const uint8_t i, const uint8_t decimals,
+                int32_t* value);
+
+        /**
+         * @brief Parse a field as an UTC time (hhmmss.sss).
+         * @param i Field index.
+         * @param time_ms Result (ms of the day).
+         * @return true Field parsed.
+         * @return false Missing, empty or invalid field.
+         */
+        bool field_time(const uint8_t i, uint32_t* time_ms);
+
+        /**
+         * @brief Parse two fields as a coordinate and its hemisphere
+         * (dddmm.mmmmm and N/S/E/W).
+         * @param i Coordinate field index.
+         * @param coord Result (1e-7 degrees).
+         * @return true Fields parsed.
+         * @return false Missing, empty or invalid fields.
+         */
+        bool field_coord(const uint8_t i, int32_t* coord);
+
+        /**
+         * @brief Get the value of an hexadecimal digit.
+         * @param c Digit character.
+         * @return int8_t Digit value (-1 if it is not a digit).
+         */
+        static int8_t hex_value(const char c);
+
+        /**
+         * @brief Complete the record of the current epoch if a sentence
+         * has a different UTC time (a new epoch starts).
+         * @param time_ms Sentence UTC time (ms of the day).
+         * @return true A record is ready.
+         * @return false No record.
+         */
+        bool epoch_start(const uint32_t time_ms);
+
+        /**
+         * @brief Parse the fields of a GGA sentence.
+         * @param gga Result.
+         * @return true Sentence parsed.
+         * @return false Invalid sentence.
+         */
+        bool parse_gga(s_gga* gga);
+
+        /**
+         * @brief Parse the fields of a RMC sentence.
+         * @param rmc Result.
+         * @return true Sentence parsed.
+         * @return false Invalid sentence.
+         */
+        bool parse_rmc(s_rmc* rmc);
+
+        /**
+         * @brief Parse the fields of a VTG sentence.
+         * @param vtg Result.
+         * @return true Sentence parsed.
+         * @return false Invalid sentence.
+         */
+        bool parse_vtg(s_vtg* vtg);
+
+        /**
+         * @brief Parse the fields of a GSV sentence.
+         * @param gsv Result.
+         * @return true Sentence parsed.
+         * @return false Invalid sentence.
+         */
+        bool parse_gsv(s_gsv* gsv);
+
+        /**
+         * @brief Merge a GSV sentence into the satellites in view of its
+         * talker, updating the fix when its sequence is complete.
+         * @param talker Talker ID second character.
+         * @param gsv Sentence.
+         */
+        void merge_gsv(const char talker, const s_gsv* gsv);
+
+        /**
+         * @brief Complete the epoch: build the record of the fields that
+         * changed beyond their deadbands since they were last published.
+         * @return true A record is ready.
+         * @return false Nothing changed.
+         */
+        bool build_record();
+
+        /**
+         * @brief Append a fixed point field to the record.
+         * @param key Field name.
+         * @param value Field value.
+         * @param decimals Number of decimals of the value.
+         */
+        void append_field(const char* key, const int64_t value,
+                const uint8_t decimals);
+
+        /**
+         * @brief Account the characters written to the record by snprintf()
+         * (the record is truncated if they don't fit).
+         * @param n snprintf() return value.
+         */
+        void record_advance(const int n);
+
+        /**
+         * @brief Check if a field changed beyond its deadband.
+         * @param value Current value.
+         * @param last Last published value.
+         * @param field Deadband field.
+         * @return true Changed beyond the deadband.
+         * @return false Within the deadband.
+         */
+        bool exceeds(const int32_t value, const int32_t last,
+                const t_deadband field);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Fields of the sentence being decoded.
+         */
+        const char* field[MAX_FIELDS];
+        uint8_t field_len[MAX_FIELDS];
+        uint8_t num_fields;
+
+        /**
+         * @brief Current fix, and values of the last published record.
+         */
+        s_fix fix;
+        s_fix published;
+
+        /**
+         * @brief Satellites in view of each talker (complete sequences),
+         * and of the sequence being received.
+         */
+        s_sky sky[MAX_TALKERS];
+        s_sky sky_rx[MAX_TALKERS];
+
+        /**
+         * @brief The current epoch has sentences not yet checked for
+         * changes, and the reception time of the last one (us).
+         */
+        bool epoch_pending;
+        int64_t t_last_us;
+
+        /**
+         * @brief Fields deadbands.
+         */
+        uint32_t deadband[(uint8_t)(t_deadband::NUM)];
+
+        /**
+         * @brief Last record.
+         */
+        char record[MAX_RECORD_LEN];
+        uint32_t record_len;
+
+        /**
+         * @brief Publish the raw lines too.
+         */
+        bool raw;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_NMEA_H */
@@ -0,0 +1,250 @@
+/**
+ * @file    uart_overload.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx overload (uplink slower than capture) detector source
+ * file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+/* Libraries */
+
+// Header Interface
+#include "uart_overload.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes a not overloaded
+ * detector with all the counters cleared.
+ */
+UARTOverload::UARTOverload()
+{
+    overloaded = false;
+    capture_rate = 0U;
+    publish_rate = UINT32_MAX;
+    num_transitions = 0U;
+    num_lost = 0U;
+    last_sum_frames = 0U;
+    last_sum_bytes = 0U;
+    reset(0U, 0U, 0U);
+}
+
+/**
+ * @details This function starts a new measure window from the current
+ * capture counters, so the bytes captured before don't count in the rates.
+ * Leaving the overload is accounted as a transition.
+ */
+void UARTOverload::reset(const uint32_t t_now, const uint32_t num_captured,
+        const uint32_t num_dropped)
+{
+    if (overloaded)
+    {   num_transitions = num_transitions + 1U;   }
+    overloaded = false;
+    t_window = t_now;
+    window_captured = num_captured;
+    window_dropped = num_dropped;
+    last_dropped = num_dropped;
+    handled_len = 0U;
+    handled_us = 0U;
+    sum_frames = 0U;
+    sum_bytes = 0U;
+}
+
+/**
+ * @details This function accumulates the bytes handled in the window and the
+ * time spent handling them (the uplink write time included), from which the
+ * publish throughput is calculated.
+ */
+void UARTOverload::add_handled(const uint32_t len, const uint32_t t_us)
+{
+    handled_len = handled_len + len;
+    handled_us = handled_us + t_us;
+}
+
+/**
+ * @details This function accounts bytes discarded by the overload policy
+ * outside of the capture (i.e. the oldest Rx data of the ring buffer).
+ */
+void UARTOverload::add_dropped(const uint32_t len)
+{
+    num_lost = num_lost + len;
+}
+
+/**
+ * @details This function accounts a frame that was summarized instead of
+ * being published.
+ */
+void UARTOverload::add_summarized(const uint32_t len)
+{
+    sum_frames = sum_frames + 1U;
+    sum_bytes = sum_bytes + len;
+    num_lost = num_lost + len;
+}
+
+/**
+ * @details This function accounts the capture drops made while overloaded,
+ * enters the overload at once if the Rx ring buffer backlog reaches the high
+ * fill mark and, at the end of each measure window, calculates the capture
+ * and publish rates to enter the overload (capture rate over the publish
+ * throughput) or to recover from it (capture rate under the throughput with
+ * margin and backlog under the low fill mark).
+ */
+UARTOverload::t_event UARTOverload::update(const uint32_t t_now,
+        const uint32_t num_captured, const uint32_t num_dropped,
+        const uint32_t fill_pct)
+{
+    t_event event = t_event::NONE;
+    uint32_t t_elapsed = t_now - t_window;
+    uint64_t rate = 0U;
+
+    // Account the capture drops made while overloaded
+    if (overloaded)
+    {   num_lost = num_lost + (num_dropped - last_dropped);   }
+    last_dropped = num_dropped;
+
+    // Enter the overload if the backlog is too big
+    if ( (!overloaded) && (fill_pct >= HIGH_FILL_PCT) )
+    {
+        overloaded = true;
+        num_transitions = num_transitions + 1U;
+        event = t_event::ENTER;
+    }
+
+    // Do nothing else until the end of the measure window
+    if (t_elapsed < WINDOW_MS)
+    {   return event;   }
+
+    // Calculate the window rates (the dropped bytes were captured too)
+    rate = (uint64_t)(num_captured - window_captured);
+    rate = rate + (uint64_t)(num_dropped - window_dropped);
+    capture_rate = (uint32_t)((rate * 1000U) / t_elapsed);
+    if (handled_us == 0U)
+    {   publish_rate = UINT32_MAX;   }
+    else
+    {
+        rate = ((uint64_t)handled_len * 1000000U) / handled_us;
+        if (rate > UINT32_MAX)
+        {   rate = UINT32_MAX;   }
+        publish_rate = (uint32_t)(rate);
+    }
+    last_sum_frames = sum_frames;
+    last_sum_bytes = sum_bytes;
+
+    // Start the next window
+    t_window = t_now;
+    window_captured = num_captured;
+    window_dropped = num_dropped;
+    handled_len = 0U;
+    handled_us = 0U;
+    sum_frames = 0U;
+    sum_bytes = 0U;
+
+    // Update the overload state
+    if (!overloaded)
+    {
+        if (capture_rate > publish_rate)
+        {
+            overloaded = true;
+            num_transitions = num_transitions + 1U;
+            event = t_event::ENTER;
+        }
+    }
+    else if (event == t_event::NONE)
+    {
+        rate = ((uint64_t)publish_rate * RECOVER_RATE_PCT) / 100U;
+        if ( ((uint64_t)capture_rate <= rate) && (fill_pct <= LOW_FILL_PCT) )
+        {
+            overloaded = false;
+            num_transitions = num_transitions + 1U;
+            event = t_event::EXIT;
+        }
+        else
+        {   event = t_event::WINDOW;   }
+    }
+
+    return event;
+}
+
+/**
+ * @details This function returns the overload state.
+ */
+bool UARTOverload::is_overloaded()
+{
+    return overloaded;
+}
+
+/**
+ * @details This function returns the capture rate of the last window.
+ */
+uint32_t UARTOverload::get_capture_rate()
+{
+    return capture_rate;
+}
+
+/**
+ * @details This function returns the publish throughput of the last window.
+ */
+uint32_t UARTOverload::get_publish_rate()
+{
+    return publish_rate;
+}
+
+/**
+ * @details This function returns the number of overload state transitions.
+ */
+uint32_t UARTOverload::get_num_transitions()
+{
+    return num_transitions;
+}
+
+/**
+ * @details This function returns the number of bytes lost while overloaded.
+ */
+uint32_t UARTOverload::get_num_lost()
+{
+    return num_lost;
+}
+
+/**
+ * @details This function returns the frames summarized in the last window.
+ */
+void UARTOverload::get_summary(uint32_t* num_frames, uint32_t* num_bytes)
+{
+    *num_frames = last_sum_frames;
+    *num_bytes = last_sum_bytes;
+}
+
+/*****************************************************************************/
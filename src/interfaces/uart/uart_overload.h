@@ -0,0 +1,274 @@
+/**
+ * @file    uart_overload.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx overload (uplink slower than capture) detector header
+ * file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_OVERLOAD_H
+#define UART_OVERLOAD_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief UART Rx overload detector. It measures, in windows of fixed time,
+ * the capture rate of a Port (bytes received, stored or dropped) and its
+ * publish throughput (bytes handled per second spent handling them, so it
+ * is the rate that the uplink could sustain). The Port becomes overloaded
+ * when the capture rate exceeds the publish throughput, or at once if the
+ * Rx ring buffer backlog reaches the high fill mark, and it recovers when
+ * the capture rate is back under the throughput (with a margin) and the
+ * backlog is under the low fill mark.
+ * The Rx data lost while the Port is overloaded (dropped, or summarized
+ * instead of published) is accounted.
+ */
+class UARTOverload
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+    public:
+
+        /**
+         * @brief Measure window (ms).
+         */
+        static constexpr uint32_t WINDOW_MS = 1000U;
+
+        /**
+         * @brief Rx ring buffer high and low fill marks (%).
+         */
+        static constexpr uint32_t HIGH_FILL_PCT = 75U;
+        static constexpr uint32_t LOW_FILL_PCT = 25U;
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Capture rate to recover from the overload (% of the
+         * publish throughput).
+         */
+        static constexpr uint32_t RECOVER_RATE_PCT = 80U;
+
+    /******************************************************************/
+
+    /* Public Data Types */
+
+    public:
+
+        /**
+         * @brief Detector update events.
+         */
+        enum class t_event : uint8_t
+        {
+            // Nothing to report
+            NONE = 0U,
+
+            // The Port became overloaded
+            ENTER = 1U,
+
+            // The Port recovered from the overload
+            EXIT = 2U,
+
+            // A measure window ended while overloaded
+            WINDOW = 3U
+        };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new Overload detector object (not overloaded).
+         */
+        UARTOverload();
+
+        /**
+         * @brief Restart the measure (i.e. when the Port capture starts),
+         * leaving the overload (the counters are kept).
+         * @param t_now Current time (ms).
+         * @param num_captured Number of bytes stored by the Port capture.
+         * @param num_dropped Number of bytes dropped by the capture.
+         */
+        void reset(const uint32_t t_now, const uint32_t num_captured,
+                const uint32_t num_dropped);
+
+        /**
+         * @brief Account the bytes handled by the Interface and the time
+         * spent handling them.
+         * @param len Number of bytes handled.
+         * @param t_us Handling time (us).
+         */
+        void add_handled(const uint32_t len, const uint32_t t_us);
+
+        /**
+         * @brief Account bytes discarded by the overload policy.
+         * @param len Number of bytes.
+         */
+        void add_dropped(const uint32_t len);
+
+        /**
+         * @brief Account a frame summarized instead of published.
+         * @param len Frame length.
+         */
+        void add_summarized(const uint32_t len);
+
+        /**
+         * @brief Update the overload state. The capture drops made while
+         * the Port is overloaded are accounted as overload losses.
+         * @param t_now Current time (ms).
+         * @param num_captured Number of bytes stored by the capture.
+         * @param num_dropped Number of bytes dropped by the capture.
+         * @param fill_pct Rx ring buffer fill (%).
+         * @return t_event Event to report.
+         */
+        t_event update(const uint32_t t_now, const uint32_t num_captured,
+                const uint32_t num_dropped, const uint32_t fill_pct);
+
+        /**
+         * @brief Check if the Port is overloaded.
+         * @return true Overloaded.
+         * @return false Not overloaded.
+         */
+        bool is_overloaded();
+
+        /**
+         * @brief Get the capture rate of the last window.
+         * @return uint32_t Capture rate (bytes/s).
+         */
+        uint32_t get_capture_rate();
+
+        /**
+         * @brief Get the publish throughput of the last window.
+         * @return uint32_t Publish throughput (bytes/s, UINT32_MAX if
+         * nothing was handled).
+         */
+        uint32_t get_publish_rate();
+
+        /**
+         * @brief Get the number of overload state transitions.
+         * @return uint32_t Number of transitions.
+         */
+        uint32_t get_num_transitions();
+
+        /**
+         * @brief Get the number of bytes lost while overloaded (dropped or
+         * summarized).
+         * @return uint32_t Number of bytes.
+         */
+        uint32_t get_num_lost();
+
+        /**
+         * @brief Get the frames summarized in the last window.
+         * @param num_frames Number of frames.
+         * @param num_bytes Number of bytes.
+         */
+        void get_summary(uint32_t* num_frames, uint32_t* num_bytes);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief The Port is overloaded.
+         */
+        bool overloaded;
+
+        /**
+         * @brief Current window start time (ms), and captured and dropped
+         * bytes counts at its start.
+         */
+        uint32_t t_window;
+        uint32_t window_captured;
+        uint32_t window_dropped;
+
+        /**
+         * @brief Dropped bytes count at the last update.
+         */
+        uint32_t last_dropped;
+
+        /**
+         * @brief Bytes handled and handling time (us) in the current
+         * window.
+         */
+        uint32_t handled_len;
+        uint64_t handled_us;
+
+        /**
+         * @brief Frames and bytes summarized in the current window, and in
+         * the last one.
+         */
+        uint32_t sum_frames;
+        uint32_t sum_bytes;
+        uint32_t last_sum_frames;
+        uint32_t last_sum_bytes;
+
+        /**
+         * @brief Rates of the last window (bytes/s).
+         */
+        uint32_t capture_rate;
+        uint32_t publish_rate;
+
+        /**
+         * @brief Counters.
+         */
+        uint32_t num_transitions;
+        uint32_t num_lost;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_OVERLOAD_H */
@@ -0,0 +1,290 @@
+/**
+ * @file    uart_recorder.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART flight recorder (pre/post trigger capture) source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_recorder.h"
+
+// C++ Standard Libraries
+#include <cstring>
+
+// ESP-IDF Heap Memory Allocation
+#include "esp_heap_caps.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes a disabled recorder
+ * without history buffer.
+ */
+UARTRecorder::UARTRecorder()
+{
+    buffer = nullptr;
+    size = 0U;
+    post_size = 0U;
+    state = t_state::OFF;
+    head = 0U;
+    length = 0U;
+    post_count = 0U;
+    dump_pos = 0U;
+    num_dumps = 0U;
+    num_missed = 0U;
+}
+
+/**
+ * @details This function releases the current history buffer and allocates a
+ * new one (from PSRAM on boards that have it, so big histories don't use the
+ * internal RAM), then starts recording.
+ */
+bool UARTRecorder::configure(const uint32_t size, const uint32_t post_size)
+{
+    if (buffer != nullptr)
+    {
+        heap_caps_free(buffer);
+        buffer = nullptr;
+    }
+    this->size = 0U;
+    this->post_size = 0U;
+    state = t_state::OFF;
+    head = 0U;
+    length = 0U;
+    post_count = 0U;
+    dump_pos = 0U;
+
+    // Disable request
+    if (size == 0U)
+    {   return true;   }
+
+    #if defined(BOARD_HAS_PSRAM)
+        buffer = (uint8_t*)(heap_caps_malloc(size, MALLOC_CAP_SPIRAM));
+    #else
+        buffer = (uint8_t*)(heap_caps_malloc(size, MALLOC_CAP_8BIT));
+    #endif
+    if (buffer == nullptr)
+    {   return false;   }
+
+    this->size = size;
+    this->post_size = (post_size < size) ? post_size : size;
+    state = t_state::RECORDING;
+
+    return true;
+}
+
+/**
+ * @details This function copies the data into the history buffer overwriting
+ * the oldest bytes. After a trigger, the post-trigger bytes are counted and
+ * the history is frozen once the post-trigger window is complete.
+ */
+void UARTRecorder::write(const uint8_t* data, const uint32_t len)
+{
+    // Do nothing if the recorder is disabled
+    if (state == t_state::OFF)
+    {   return;   }
+
+    // The history is frozen while dumping
+    if (state == t_state::DUMPING)
+    {
+        num_missed = num_missed + len;
+        return;
+    }
+
+    uint32_t num_written = 0U;
+    while (num_written < len)
+    {
+        uint32_t to_copy = len - num_written;
+        if (to_copy > size - head)
+        {   to_copy = size - head;   }
+        if ( (state == t_state::POST_TRIGGER) &&
+             (to_copy > post_size - post_count) )
+        {   to_copy = post_size - post_count;   }
+
+        memcpy(&(buffer[head]), &(data[num_written]), to_copy);
+        head = (head + to_copy) % size;
+        length = length + to_copy;
+        if (length > size)
+        {   length = size;   }
+        num_written = num_written + to_copy;
+
+        if (state == t_state::POST_TRIGGER)
+        {
+            post_count = post_count + to_copy;
+            if (post_count >= post_size)
+            {
+                freeze();
+                num_missed = num_missed + (len - num_written);
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @details This function starts the post-trigger window (or freezes the
+ * history directly if there is no post-trigger window).
+ */
+bool UARTRecorder::trigger()
+{
+    // Do nothing if not recording
+    if (state != t_state::RECORDING)
+    {   return false;   }
+
+    post_count = 0U;
+    if (post_size == 0U)
+    {   freeze();   }
+    else
+    {   state = t_state::POST_TRIGGER;   }
+
+    return true;
+}
+
+/**
+ * @details The dump goes from the oldest byte of the history to the newest
+ * one, and its contiguous regions end at the end of the history buffer.
+ */
+uint32_t UARTRecorder::dump_region(const uint8_t** ptr)
+{
+    // Do nothing if not dumping
+    if (state != t_state::DUMPING)
+    {   return 0U;   }
+
+    uint32_t start = (head + size - length) % size;
+    uint32_t pos = (start + dump_pos) % size;
+    uint32_t region = length - dump_pos;
+    if (region > size - pos)
+    {   region = size - pos;   }
+
+    *ptr = &(buffer[pos]);
+    return region;
+}
+
+/**
+ * @details This function advances the dump position and restarts recording
+ * with an empty history when the dump is complete.
+ */
+void UARTRecorder::dump_consume(const uint32_t len)
+{
+    // Do nothing if not dumping
+    if (state != t_state::DUMPING)
+    {   return;   }
+
+    dump_pos = dump_pos + len;
+    if (dump_pos < length)
+    {   return;   }
+
+    head = 0U;
+    length = 0U;
+    post_count = 0U;
+    dump_pos = 0U;
+    state = t_state::RECORDING;
+}
+
+/**
+ * @details Getter method to return the recorder state.
+ */
+UARTRecorder::t_state UARTRecorder::get_state()
+{
+    return state;
+}
+
+/**
+ * @details Getter method to return the history buffer size.
+ */
+uint32_t UARTRecorder::get_size()
+{
+    return size;
+}
+
+/**
+ * @details Getter method to return the length of the dump.
+ */
+uint32_t UARTRecorder::get_dump_length()
+{
+    return (state == t_state::DUMPING) ? length : 0U;
+}
+
+/**
+ * @details The pre-trigger bytes are the history bytes before the
+ * post-trigger window.
+ */
+uint32_t UARTRecorder::get_trigger_pos()
+{
+    return (state == t_state::DUMPING) ? (length - post_count) : 0U;
+}
+
+/**
+ * @details Getter method to return the dumped bytes.
+ */
+uint32_t UARTRecorder::get_dump_pos()
+{
+    return dump_pos;
+}
+
+/**
+ * @details Getter method to return the number of dumps.
+ */
+uint32_t UARTRecorder::get_num_dumps()
+{
+    return num_dumps;
+}
+
+/**
+ * @details Getter method to return the number of missed bytes.
+ */
+uint32_t UARTRecorder::get_num_missed()
+{
+    return num_missed;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details This function stops recording so the history is kept unchanged
+ * until it is dumped.
+ */
+void UARTRecorder::freeze()
+{
+    state = t_state::DUMPING;
+    dump_pos = 0U;
+    num_dumps = num_dumps + 1U;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,250 @@
+/**
+ * @file    uart_recorder.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART flight recorder (pre/post trigger capture) header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_RECORDER_H
+#define UART_RECORDER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief UART flight recorder. It keeps the last received bytes of a Port in
+ * a circular history buffer (in PSRAM if the board has it) without publishing
+ * them. When triggered, it keeps recording the post-trigger window and then
+ * freezes the history (pre-trigger plus post-trigger data) to be dumped in
+ * chunks. Recording restarts once the dump is done.
+ * All the methods must be called from the same task.
+ */
+class UARTRecorder
+{
+    /******************************************************************/
+
+    /* Public Data Types */
+
+    public:
+
+        /**
+         * @brief Recorder state.
+         */
+        enum class t_state : uint8_t
+        {
+            OFF = 0U,
+            RECORDING = 1U,
+            POST_TRIGGER = 2U,
+            DUMPING = 3U
+        };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new Recorder object (disabled).
+         */
+        UARTRecorder();
+
+        /**
+         * @brief Allocate the history buffer and start recording (any
+         * previous history is discarded).
+         * @param size History buffer size (0 to disable the recorder and
+         * release the buffer).
+         * @param post_size Post-trigger window size (up to size).
+         * @return true Recorder configured.
+         * @return false Buffer allocation fail (the recorder is disabled).
+         */
+        bool configure(const uint32_t size, const uint32_t post_size);
+
+        /**
+         * @brief Record received data. Data received while the history is
+         * frozen to be dumped is not recorded (it is counted as missed).
+         * @param data Received data.
+         * @param len Number of received bytes.
+         */
+        void write(const uint8_t* data, const uint32_t len);
+
+        /**
+         * @brief Fire the trigger (ignored if not recording).
+         * @return true Trigger fired.
+         * @return false Not recording.
+         */
+        bool trigger();
+
+        /**
+         * @brief Get the next contiguous region of the data to dump.
+         * @param ptr Pointer to store the address of the region.
+         * @return uint32_t Region length (0 if nothing to dump).
+         */
+        uint32_t dump_region(const uint8_t** ptr);
+
+        /**
+         * @brief Release dumped data. Recording restarts when all the data
+         * has been dumped.
+         * @param len Number of dumped bytes.
+         */
+        void dump_consume(const uint32_t len);
+
+        /**
+         * @brief Get the recorder state.
+         * @return t_state Recorder state.
+         */
+        t_state get_state();
+
+        /**
+         * @brief Get the history buffer size.
+         * @return uint32_t History buffer size (0 if disabled).
+         */
+        uint32_t get_size();
+
+        /**
+         * @brief Get the length of the dump in progress.
+         * @return uint32_t Dump length.
+         */
+        uint32_t get_dump_length();
+
+        /**
+         * @brief Get the position of the trigger in the dump in progress
+         * (number of pre-trigger bytes).
+         * @return uint32_t Trigger position.
+         */
+        uint32_t get_trigger_pos();
+
+        /**
+         * @brief Get the number of bytes of the dump in progress already
+         * dumped.
+         * @return uint32_t Dumped bytes.
+         */
+        uint32_t get_dump_pos();
+
+        /**
+         * @brief Get the number of dumps started since boot.
+         * @return uint32_t Number of dumps.
+         */
+        uint32_t get_num_dumps();
+
+        /**
+         * @brief Get the number of bytes not recorded while dumping.
+         * @return uint32_t Number of missed bytes.
+         */
+        uint32_t get_num_missed();
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Freeze the history to be dumped.
+         */
+        void freeze();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief History buffer.
+         */
+        uint8_t* buffer;
+
+        /**
+         * @brief History buffer size.
+         */
+        uint32_t size;
+
+        /**
+         * @brief Post-trigger window size.
+         */
+        uint32_t post_size;
+
+        /**
+         * @brief Recorder state.
+         */
+        t_state state;
+
+        /**
+         * @brief Write position in the history buffer.
+         */
+        uint32_t head;
+
+        /**
+         * @brief Number of bytes in the history buffer.
+         */
+        uint32_t length;
+
+        /**
+         * @brief Number of post-trigger bytes recorded.
+         */
+        uint32_t post_count;
+
+        /**
+         * @brief Number of bytes of the dump in progress already dumped.
+         */
+        uint32_t dump_pos;
+
+        /**
+         * @brief Number of dumps started since boot.
+         */
+        uint32_t num_dumps;
+
+        /**
+         * @brief Number of bytes not recorded while dumping.
+         */
+        uint32_t num_missed;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_RECORDER_H */
@@ -0,0 +1,267 @@
+/**
+ * @file    uart_ring_buffer.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Single-Producer Single-Consumer Lock-Free Ring Buffer
+ * source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_ring_buffer.h"
+
+// C++ Standard Libraries
+#include <cstring>
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes the Ring Buffer without
+ * storage, so nothing can be written until set_storage() is called.
+ */
+UARTRingBuffer::UARTRingBuffer()
+{
+    buffer = nullptr;
+    buffer_size = 0U;
+    mask = 0U;
+    head.store(0U);
+    tail.store(0U);
+    high_water_mark.store(0U);
+    num_dropped.store(0U);
+}
+
+/**
+ * @details This function checks that the provided size is a power of two and
+ * set the provided memory as the Ring Buffer storage.
+ */
+bool UARTRingBuffer::set_storage(uint8_t* memory, const uint32_t size)
+{
+    // Check for valid storage (null storage is allowed to release it)
+    if ( (memory != nullptr) &&
+         ((size == 0U) || ((size & (size - 1U)) != 0U)) )
+    {   return false;   }
+
+    buffer = memory;
+    buffer_size = (memory != nullptr) ? size : 0U;
+    mask = (buffer_size > 0U) ? (buffer_size - 1U) : 0U;
+    reset();
+
+    return true;
+}
+
+/**
+ * @details This function clears read/write counters and statistics.
+ */
+void UARTRingBuffer::reset()
+{
+    head.store(0U, std::memory_order_relaxed);
+    tail.store(0U, std::memory_order_relaxed);
+    high_water_mark.store(0U, std::memory_order_relaxed);
+    num_dropped.store(0U, std::memory_order_relaxed);
+}
+
+/**
+ * @details Getter method to return the storage size.
+ */
+uint32_t UARTRingBuffer::size()
+{   return buffer_size;   }
+
+/**
+ * @details The number of bytes stored is the distance between the write and
+ * read free running counters.
+ */
+uint32_t UARTRingBuffer::available()
+{
+    uint32_t h = head.load(std::memory_order_acquire);
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    return (h - t);
+}
+
+/**
+ * @details The free space is the storage size minus the stored bytes.
+ */
+uint32_t UARTRingBuffer::free_space()
+{
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_acquire);
+    return (buffer_size - (h - t));
+}
+
+/**
+ * @details This function copies the data into the free regions of the buffer
+ * (splitting the copy in two when the end of the storage is reached), then
+ * publish it to the consumer.
+ */
+uint32_t UARTRingBuffer::write(const uint8_t* data, const uint32_t len)
+{
+    uint32_t num_written = 0U;
+
+    while (num_written < len)
+    {
+        uint8_t* ptr = nullptr;
+        uint32_t region = write_region(&ptr);
+        if (region == 0U)
+        {   break;   }
+
+        uint32_t to_copy = len - num_written;
+        if (to_copy > region)
+        {   to_copy = region;   }
+        memcpy(ptr, &(data[num_written]), to_copy);
+        write_commit(to_copy);
+        num_written = num_written + to_copy;
+    }
+
+    if (num_written < len)
+    {   drop(len - num_written);   }
+
+    return num_written;
+}
+
+/**
+ * @details The contiguous free region goes from the write position until the
+ * end of the storage or until the read position.
+ */
+uint32_t UARTRingBuffer::write_region(uint8_t** ptr)
+{
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_acquire);
+    uint32_t num_free = buffer_size - (h - t);
+    uint32_t to_end = buffer_size - (h & mask);
+
+    *ptr = &(buffer[h & mask]);
+    return (num_free < to_end) ? num_free : to_end;
+}
+
+/**
+ * @details This function moves the write counter (release ordering, so the
+ * consumer sees the data before the new counter value) and update the High
+ * Water Mark.
+ */
+void UARTRingBuffer::write_commit(const uint32_t len)
+{
+    uint32_t h = head.load(std::memory_order_relaxed) + len;
+    head.store(h, std::memory_order_release);
+
+    uint32_t fill = h - tail.load(std::memory_order_acquire);
+    if (fill > high_water_mark.load(std::memory_order_relaxed))
+    {   high_water_mark.store(fill, std::memory_order_relaxed);   }
+}
+
+/**
+ * @details This function increases the overflow drop counter.
+ */
+void UARTRingBuffer::drop(const uint32_t len)
+{
+    num_dropped.store(num_dropped.load(std::memory_order_relaxed) + len,
+        std::memory_order_relaxed);
+}
+
+/**
+ * @details This function copies stored data out of the buffer (splitting the
+ * copy in two when the end of the storage is reached) and release it.
+ */
+uint32_t UARTRingBuffer::read(uint8_t* data, const uint32_t max_len)
+{
+    uint32_t num_read = 0U;
+
+    while (num_read < max_len)
+    {
+        const uint8_t* ptr = nullptr;
+        uint32_t region = read_region(&ptr);
+        if (region == 0U)
+        {   break;   }
+
+        uint32_t to_copy = max_len - num_read;
+        if (to_copy > region)
+        {   to_copy = region;   }
+        memcpy(&(data[num_read]), ptr, to_copy);
+        consume(to_copy);
+        num_read = num_read + to_copy;
+    }
+
+    return num_read;
+}
+
+/**
+ * @details The contiguous data region goes from the read position until the
+ * end of the storage or until the write position.
+ */
+uint32_t UARTRingBuffer::read_region(const uint8_t** ptr)
+{
+    uint32_t h = head.load(std::memory_order_acquire);
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t num_stored = h - t;
+    uint32_t to_end = buffer_size - (t & mask);
+
+    *ptr = &(buffer[t & mask]);
+    return (num_stored < to_end) ? num_stored : to_end;
+}
+
+/**
+ * @details This function moves the read counter (release ordering, so the
+ * producer doesn't overwrite the data before the consumer is done with it).
+ */
+void UARTRingBuffer::consume(const uint32_t len)
+{
+    tail.store(tail.load(std::memory_order_relaxed) + len,
+        std::memory_order_release);
+}
+
+/**
+ * @details Getter method to return the High Water Mark.
+ */
+uint32_t UARTRingBuffer::get_high_water_mark()
+{   return high_water_mark.load(std::memory_order_relaxed);   }
+
+/**
+ * @details Getter method to return the overflow dropped bytes counter.
+ */
+uint32_t UARTRingBuffer::get_num_dropped()
+{   return num_dropped.load(std::memory_order_relaxed);   }
+
+/**
+ * @details Getter method to return the write counter.
+ */
+uint32_t UARTRingBuffer::get_write_count()
+{   return head.load(std::memory_order_acquire);   }
+
+/**
+ * @details Getter method to return the read counter.
+ */
+uint32_t UARTRingBuffer::get_read_count()
+{   return tail.load(std::memory_order_relaxed);   }
+
+/*****************************************************************************/
@@ -0,0 +1,238 @@
+/**
+ * @file    uart_ring_buffer.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Single-Producer Single-Consumer Lock-Free Ring Buffer
+ * header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_RING_BUFFER_H
+#define UART_RING_BUFFER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief Byte ring buffer safe to be used without locks by one producer
+ * (capture side) and one consumer (publisher side) running in different
+ * tasks or cores. Size must be a power of two, read and write indexes are
+ * free running counters, so the full capacity of the buffer can be used.
+ */
+class UARTRingBuffer
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new Ring Buffer object (without storage).
+         */
+        UARTRingBuffer();
+
+        /**
+         * @brief Set the memory to be used by the Ring Buffer and clear
+         * it. Must not be called while producer or consumer are running.
+         * @param memory Storage memory to use.
+         * @param size Size of the storage memory (power of two).
+         * @return true Storage set.
+         * @return false Invalid storage size.
+         */
+        bool set_storage(uint8_t* memory, const uint32_t size);
+
+        /**
+         * @brief Clear the Ring Buffer content and statistics. Must not
+         * be called while producer or consumer are running.
+         */
+        void reset();
+
+        /**
+         * @brief Get the capacity of the Ring Buffer.
+         * @return uint32_t Number of bytes that can be stored.
+         */
+        uint32_t size();
+
+        /**
+         * @brief Get the number of bytes stored (consumer side).
+         * @return uint32_t Number of bytes ready to be read.
+         */
+        uint32_t available();
+
+        /**
+         * @brief Get the number of free bytes (producer side).
+         * @return uint32_t Number of bytes that can be written.
+         */
+        uint32_t free_space();
+
+        /**
+         * @brief Write data into the Ring Buffer (producer side). Bytes
+         * that don't fit are dropped and accounted in the overflow drop
+         * counter.
+         * @param data Data to write.
+         * @param len Number of bytes to write.
+         * @return uint32_t Number of bytes written.
+         */
+        uint32_t write(const uint8_t* data, const uint32_t len);
+
+        /**
+         * @brief Get the contiguous free region where the producer can
+         * write data directly (to be completed with write_commit()).
+         * @param ptr Pointer to store the address of the free region.
+         * @return uint32_t Number of contiguous bytes that can be written.
+         */
+        uint32_t write_region(uint8_t** ptr);
+
+        /**
+         * @brief Publish bytes written directly in the free region to the
+         * consumer.
+         * @param len Number of bytes written.
+         */
+        void write_commit(const uint32_t len);
+
+        /**
+         * @brief Account bytes that the producer had to drop due to lack of
+         * space.
+         * @param len Number of bytes dropped.
+         */
+        void drop(const uint32_t len);
+
+        /**
+         * @brief Read data from the Ring Buffer (consumer side).
+         * @param data Buffer to store the read data.
+         * @param max_len Maximum number of bytes to read.
+         * @return uint32_t Number of bytes read.
+         */
+        uint32_t read(uint8_t* data, const uint32_t max_len);
+
+        /**
+         * @brief Get the contiguous region of stored data that the consumer
+         * can access without copying it (to be completed with consume()).
+         * @param ptr Pointer to store the address of the data region.
+         * @return uint32_t Number of contiguous bytes available.
+         */
+        uint32_t read_region(const uint8_t** ptr);
+
+        /**
+         * @brief Release bytes accessed through read_region().
+         * @param len Number of bytes to release.
+         */
+        void consume(const uint32_t len);
+
+        /**
+         * @brief Get the maximum number of bytes that has been stored at
+         * the same time (High Water Mark).
+         * @return uint32_t High Water Mark.
+         */
+        uint32_t get_high_water_mark();
+
+        /**
+         * @brief Get the number of bytes dropped due to buffer overflow.
+         * @return uint32_t Number of bytes dropped.
+         */
+        uint32_t get_num_dropped();
+
+        /**
+         * @brief Get the free-running write counter (total bytes written,
+         * wraps at 2^32), used as stream offset of the next written byte.
+         * @return uint32_t Write counter.
+         */
+        uint32_t get_write_count();
+
+        /**
+         * @brief Get the free-running read counter (total bytes consumed,
+         * wraps at 2^32), used as stream offset of the next read byte.
+         * @return uint32_t Read counter.
+         */
+        uint32_t get_read_count();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Storage memory.
+         */
+        uint8_t* buffer;
+
+        /**
+         * @brief Storage memory size.
+         */
+        uint32_t buffer_size;
+
+        /**
+         * @brief Index mask (size - 1).
+         */
+        uint32_t mask;
+
+        /**
+         * @brief Write counter (only modified by the producer).
+         */
+        std::atomic<uint32_t> head;
+
+        /**
+         * @brief Read counter (only modified by the consumer).
+         */
+        std::atomic<uint32_t> tail;
+
+        /**
+         * @brief High Water Mark (only modified by the producer).
+         */
+        std::atomic<uint32_t> high_water_mark;
+
+        /**
+         * @brief Overflow dropped bytes (only modified by the producer).
+         */
+        std::atomic<uint32_t> num_dropped;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_RING_BUFFER_H */
@@ -0,0 +1,241 @@
+/**
+ * @file    uart_tcp_server.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART raw TCP serial server (one client) source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_tcp_server.h"
+
+// C Standard Libraries
+#include <cerrno>
+#include <unistd.h>
+
+// lwIP Sockets
+#include "lwip/sockets.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes a stopped server.
+ */
+UARTTCPServer::UARTTCPServer()
+{
+    listen_fd = -1;
+    client_fd = -1;
+    port = 0U;
+    num_dropped = 0U;
+}
+
+/**
+ * @details This function creates a non-blocking listening socket bound to
+ * any local address (so it keeps working if the device IP changes). The
+ * address is reusable to allow restarting the server right after stopping
+ * it. The backlog is 1 as only one client is served.
+ */
+bool UARTTCPServer::start(const uint16_t port)
+{
+    stop();
+
+    int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd < 0)
+    {   return false;   }
+
+    int opt = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if ( (bind(fd, (struct sockaddr*)(&addr), sizeof(addr)) < 0) ||
+         (listen(fd, 1) < 0) )
+    {
+        close(fd);
+        return false;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+    listen_fd = fd;
+    this->port = port;
+    num_dropped = 0U;
+    return true;
+}
+
+/**
+ * @details This function closes the client and the listening sockets.
+ */
+void UARTTCPServer::stop()
+{
+    close_client();
+    if (listen_fd >= 0)
+    {
+        close(listen_fd);
+        listen_fd = -1;
+    }
+    port = 0U;
+}
+
+/**
+ * @details This function accepts a pending connection from the listening
+ * socket, making it non-blocking and disabling the Nagle algorithm so each
+ * chunk of UART data is sent without waiting to coalesce it with the next
+ * one (lowest latency for interactive sessions).
+ */
+void UARTTCPServer::accept_client()
+{
+    // Do nothing if the server is not listening
+    if (listen_fd < 0)
+    {   return;   }
+
+    int fd = accept(listen_fd, nullptr, nullptr);
+    if (fd < 0)
+    {   return;   }
+
+    // Only one client is served
+    if (client_fd >= 0)
+    {
+        close(fd);
+        return;
+    }
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    int opt = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+    client_fd = fd;
+}
+
+/**
+ * @details This function sends as much data as the socket send buffer can
+ * take. The rest is dropped, so a slow client never stalls the capture. The
+ * connection is closed on any error other than the buffer being full.
+ */
+uint32_t UARTTCPServer::send(const uint8_t* data, const uint32_t len)
+{
+    // Do nothing if there is no client
+    if (client_fd < 0)
+    {   return 0U;   }
+
+    uint32_t num_sent = 0U;
+    while (num_sent < len)
+    {
+        int rc = ::send(client_fd, &(data[num_sent]),
+            (size_t)(len - num_sent), MSG_DONTWAIT);
+        if (rc > 0)
+        {
+            num_sent = num_sent + (uint32_t)(rc);
+            continue;
+        }
+        if ( (rc < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) )
+        {   close_client();   }
+        break;
+    }
+
+    num_dropped = num_dropped + (len - num_sent);
+    return num_sent;
+}
+
+/**
+ * @details This function reads the data available in the client socket. The
+ * connection is closed if the client closed it or on any error other than
+ * no data being available.
+ */
+uint32_t UARTTCPServer::receive(uint8_t* buffer, const uint32_t size)
+{
+    // Do nothing if there is no client or no room for the data
+    if ( (client_fd < 0) || (size == 0U) )
+    {   return 0U;   }
+
+    int rc = recv(client_fd, buffer, (size_t)(size), MSG_DONTWAIT);
+    if (rc > 0)
+    {   return (uint32_t)(rc);   }
+    if ( (rc == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK)) )
+    {   close_client();   }
+
+    return 0U;
+}
+
+/**
+ * @details Getter method to check if the listening socket is open.
+ */
+bool UARTTCPServer::is_listening()
+{
+    return (listen_fd >= 0);
+}
+
+/**
+ * @details Getter method to check if the client socket is open.
+ */
+bool UARTTCPServer::is_connected()
+{
+    return (client_fd >= 0);
+}
+
+/**
+ * @details Getter method to return the listening TCP port.
+ */
+uint16_t UARTTCPServer::get_port()
+{
+    return port;
+}
+
+/**
+ * @details Getter method to return the number of dropped bytes.
+ */
+uint32_t UARTTCPServer::get_num_dropped()
+{
+    return num_dropped;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details This function closes the client socket.
+ */
+void UARTTCPServer::close_client()
+{
+    if (client_fd >= 0)
+    {
+        close(client_fd);
+        client_fd = -1;
+    }
+}
+
+/*****************************************************************************/
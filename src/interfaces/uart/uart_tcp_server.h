@@ -0,0 +1,183 @@
+/**
+ * @file    uart_tcp_server.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART raw TCP serial server (one client) header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_TCP_SERVER_H
+#define UART_TCP_SERVER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief Raw TCP serial server of an UART Port (ser2net style). It listens
+ * on a TCP port with lwIP non-blocking sockets and serves a single client
+ * without any framing: the received UART data is streamed as is to the
+ * client and the client data is transmitted through the UART. None of the
+ * calls block, so the data that doesn't fit in the socket send buffer is
+ * dropped (and accounted) instead of stalling the capture.
+ */
+class UARTTCPServer
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new TCP Server object.
+         */
+        UARTTCPServer();
+
+        /**
+         * @brief Start listening for a client connection.
+         * @param port TCP port to listen on.
+         * @return true Server listening.
+         * @return false Socket creation, bind or listen fail.
+         */
+        bool start(const uint16_t port);
+
+        /**
+         * @brief Close the client connection and stop listening.
+         */
+        void stop();
+
+        /**
+         * @brief Accept a pending client connection (non-blocking). If there
+         * is already a connected client, the new connection is closed.
+         */
+        void accept_client();
+
+        /**
+         * @brief Send data to the connected client without blocking. The
+         * data that can't be sent is dropped.
+         * @param data Data to send.
+         * @param len Number of bytes to send.
+         * @return uint32_t Number of bytes sent.
+         */
+        uint32_t send(const uint8_t* data, const uint32_t len);
+
+        /**
+         * @brief Receive data from the connected client without blocking.
+         * @param buffer Buffer to store the received data.
+         * @param size Buffer size.
+         * @return uint32_t Number of bytes received.
+         */
+        uint32_t receive(uint8_t* buffer, const uint32_t size);
+
+        /**
+         * @brief Check if the server is listening.
+         * @return true Server listening.
+         * @return false Server stopped.
+         */
+        bool is_listening();
+
+        /**
+         * @brief Check if there is a connected client.
+         * @return true Client connected.
+         * @return false No client.
+         */
+        bool is_connected();
+
+        /**
+         * @brief Get the TCP port the server is listening on.
+         * @return uint16_t TCP port (0 if stopped).
+         */
+        uint16_t get_port();
+
+        /**
+         * @brief Get the number of bytes dropped because the socket send
+         * buffer was full.
+         * @return uint32_t Number of dropped bytes.
+         */
+        uint32_t get_num_dropped();
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Close the client connection.
+         */
+        void close_client();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Listening socket (-1 if stopped).
+         */
+        int listen_fd;
+
+        /**
+         * @brief Client connection socket (-1 if there is no client).
+         */
+        int client_fd;
+
+        /**
+         * @brief TCP port the server is listening on.
+         */
+        uint16_t port;
+
+        /**
+         * @brief Number of bytes dropped because the socket send buffer
+         * was full.
+         */
+        uint32_t num_dropped;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_TCP_SERVER_H */
@@ -0,0 +1,468 @@
+/**
+ * @file    uart_templates.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx log lines template miner (Drain-style) source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_templates.h"
+
+// C++ Standard Libraries
+#include <cstring>
+
+// ESP-IDF Heap Memory Allocation
+#include "esp_heap_caps.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes a disabled miner without
+ * templates table.
+ */
+UARTTemplates::UARTTemplates()
+{
+    templates = nullptr;
+    num_templates = 0U;
+    next_id = 1U;
+    use_count = 0U;
+    changed = false;
+    line_num_tokens = 0U;
+    line_digits = 0U;
+    num_encoded = 0U;
+    num_raw = 0U;
+}
+
+/**
+ * @details This function releases the current templates table and allocates
+ * a new empty one (from PSRAM on boards that have it). The change is marked
+ * so the empty table is published too.
+ */
+bool UARTTemplates::configure(const bool enable)
+{
+    if (templates != nullptr)
+    {
+        heap_caps_free(templates);
+        templates = nullptr;
+    }
+    num_templates = 0U;
+    use_count = 0U;
+    changed = true;
+
+    // Disable request
+    if (enable == false)
+    {   return true;   }
+
+    uint32_t size = sizeof(s_template) * MAX_TEMPLATES;
+    #if defined(BOARD_HAS_PSRAM)
+        templates = (s_template*)(heap_caps_malloc(size, MALLOC_CAP_SPIRAM));
+    #else
+        templates = (s_template*)(heap_caps_malloc(size, MALLOC_CAP_8BIT));
+    #endif
+    if (templates == nullptr)
+    {   return false;   }
+
+    return true;
+}
+
+/**
+ * @details Getter method to check if the templates table is allocated.
+ */
+bool UARTTemplates::is_enabled()
+{
+    return (templates != nullptr);
+}
+
+/**
+ * @details This function looks for the template of the line, updating it
+ * if some of its constant tokens differ (the updated template gets a new ID
+ * so records already sent with the old one are still valid) or creating a
+ * new one if none is similar. The record is the template ID (LEB128)
+ * followed by each variable token: its length (up to 127) and text, or the
+ * number marker and its value (LEB128) for decimal numbers without leading
+ * zeros. Lines that can't be encoded (too many tokens, too long) and records
+ * that don't fit the buffer are encoded as is.
+ */
+uint32_t UARTTemplates::encode(const uint8_t* line, const uint32_t len,
+        uint8_t* out, const uint32_t out_size)
+{
+    // Do nothing if the miner is disabled
+    if (templates == nullptr)
+    {   return 0U;   }
+
+    if (tokenize(line, len) == false)
+    {   return encode_raw(line, len, out, out_size);   }
+
+    // Look for the template, updating or creating it
+    s_template* tpl = nullptr;
+    uint8_t tpl_i = find(line);
+    if (tpl_i != NO_TEMPLATE)
+    {
+        tpl = &(templates[tpl_i]);
+        uint32_t variables = tpl->variables;
+        for (uint8_t i = 0U; i < line_num_tokens; i++)
+        {
+            if (token_equal(tpl, line, i) == false)
+            {   variables = variables | (1UL << i);   }
+        }
+        if (variables != tpl->variables)
+        {
+            s_template updated;
+            if (build(&updated, line, variables) == false)
+            {   return encode_raw(line, len, out, out_size);   }
+            *tpl = updated;
+        }
+    }
+    else
+    {
+        s_template created;
+        if (build(&created, line, line_digits) == false)
+        {   return encode_raw(line, len, out, out_size);   }
+        tpl = get_free();
+        *tpl = created;
+    }
+    use_count = use_count + 1U;
+    tpl->last_used = use_count;
+
+    // Write the template ID and the variable tokens
+    uint32_t size = write_varint(tpl->id, out);
+    for (uint8_t i = 0U; i < line_num_tokens; i++)
+    {
+        if ((tpl->variables & (1UL << i)) == 0U)
+        {   continue;   }
+
+        const uint8_t* token = &(line[line_token_offset[i]]);
+        uint32_t token_len = line_token_len[i];
+        if (token_len > MAX_ARG_LEN)
+        {   return encode_raw(line, len, out, out_size);   }
+
+        bool is_number = (token_len > 0U) &&
+            (token_len <= MAX_NUMBER_DIGITS) &&
+            ( (token[0] != '0') || (token_len == 1U) );
+        uint32_t value = 0U;
+        for (uint32_t j = 0U; (j < token_len) && is_number; j++)
+        {
+            is_number = (token[j] >= '0') && (token[j] <= '9');
+            value = (value * 10U) + (uint32_t)(token[j] - '0');
+        }
+
+        // Worst case: number marker and 5 bytes LEB128
+        uint32_t arg_size = (is_number) ? 6U : (1U + token_len);
+        if (size + arg_size > out_size)
+        {   return encode_raw(line, len, out, out_size);   }
+        if (is_number)
+        {
+            out[size] = ARG_NUMBER;
+            size = size + 1U + write_varint(value, &(out[size + 1U]));
+        }
+        else
+        {
+            out[size] = (uint8_t)(token_len);
+            memcpy(&(out[size + 1U]), token, token_len);
+            size = size + 1U + token_len;
+        }
+    }
+
+    num_encoded = num_encoded + 1U;
+    return size;
+}
+
+/**
+ * @details This function writes the raw template ID followed by the line.
+ */
+uint32_t UARTTemplates::encode_raw(const uint8_t* line, const uint32_t len,
+        uint8_t* out, const uint32_t out_size)
+{
+    // Do nothing if the line doesn't fit
+    if (len + 1U > out_size)
+    {   return 0U;   }
+
+    out[0] = (uint8_t)(RAW_ID);
+    memcpy(&(out[1]), line, len);
+    num_raw = num_raw + 1U;
+
+    return len + 1U;
+}
+
+/**
+ * @details Getter method to check if the templates have changed.
+ */
+bool UARTTemplates::is_changed()
+{
+    return changed;
+}
+
+/**
+ * @details Setter method to clear the templates changed mark.
+ */
+void UARTTemplates::set_published()
+{
+    changed = false;
+}
+
+/**
+ * @details Getter method to return the number of templates.
+ */
+uint8_t UARTTemplates::get_num_templates()
+{
+    return num_templates;
+}
+
+/**
+ * @details Getter method to return a template ID and text.
+ */
+uint32_t UARTTemplates::get_template(const uint8_t i, uint16_t* id,
+        const uint8_t** text)
+{
+    // Do nothing if there is no such template
+    if (i >= num_templates)
+    {   return 0U;   }
+
+    *id = templates[i].id;
+    *text = templates[i].text;
+    return templates[i].len;
+}
+
+/**
+ * @details Getter method to return the number of lines encoded with a
+ * template.
+ */
+uint32_t UARTTemplates::get_num_encoded()
+{
+    return num_encoded;
+}
+
+/**
+ * @details Getter method to return the number of lines encoded as is.
+ */
+uint32_t UARTTemplates::get_num_raw()
+{
+    return num_raw;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details This function splits the line at each space (consecutive spaces
+ * give empty tokens, so joining the tokens with single spaces rebuilds the
+ * line exactly), and marks the tokens that contain digits.
+ */
+bool UARTTemplates::tokenize(const uint8_t* line, const uint32_t len)
+{
+    line_num_tokens = 0U;
+    line_digits = 0U;
+
+    uint32_t start = 0U;
+    for (uint32_t i = 0U; i <= len; i++)
+    {
+        if ( (i < len) && (line[i] != ' ') )
+        {
+            if ( (line[i] >= '0') && (line[i] <= '9') )
+            {   line_digits = line_digits | (1UL << line_num_tokens);   }
+            continue;
+        }
+
+        line_token_offset[line_num_tokens] = (uint16_t)(start);
+        line_token_len[line_num_tokens] = (uint16_t)(i - start);
+        line_num_tokens = line_num_tokens + 1U;
+        start = i + 1U;
+        if ( (i < len) && (line_num_tokens >= MAX_TOKENS) )
+        {   return false;   }
+    }
+
+    return true;
+}
+
+/**
+ * @details This function compares the line tokens with the constant tokens
+ * of each template with the same number of tokens. The similarity is the
+ * number of equal constant tokens over the number of constant tokens
+ * (templates without constant tokens match any line), and the most similar
+ * template is selected if it reaches one half. The first token (usually the
+ * log level or tag) must be equal if it is constant.
+ */
+uint8_t UARTTemplates::find(const uint8_t* line)
+{
+    uint8_t best = NO_TEMPLATE;
+    uint32_t best_equal = 0U;
+    uint32_t best_constant = 1U;
+
+    for (uint8_t t = 0U; t < num_templates; t++)
+    {
+        s_template* tpl = &(templates[t]);
+        if (tpl->num_tokens != line_num_tokens)
+        {   continue;   }
+        if ( ((tpl->variables & 1UL) == 0U) &&
+             (token_equal(tpl, line, 0U) == false) )
+        {   continue;   }
+
+        uint32_t num_constant = 0U;
+        uint32_t num_equal = 0U;
+        for (uint8_t i = 0U; i < line_num_tokens; i++)
+        {
+            if ((tpl->variables & (1UL << i)) != 0U)
+            {   continue;   }
+            num_constant = num_constant + 1U;
+            if (token_equal(tpl, line, i))
+            {   num_equal = num_equal + 1U;   }
+        }
+        if (num_constant == 0U)
+        {
+            num_constant = 1U;
+            num_equal = 1U;
+        }
+
+        // Not similar enough
+        if (num_equal * 2U < num_constant)
+        {   continue;   }
+
+        // More similar than the best one (cross-multiplied ratios)
+        if ( (best == NO_TEMPLATE) ||
+             (num_equal * best_constant > best_equal * num_constant) )
+        {
+            best = t;
+            best_equal = num_equal;
+            best_constant = num_constant;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @details This function joins the line tokens with spaces, replacing the
+ * variable ones with the "<*>" wildcard, and assigns the next ID to the
+ * template.
+ */
+bool UARTTemplates::build(s_template* tpl, const uint8_t* line,
+        const uint32_t variables)
+{
+    uint32_t len = 0U;
+    for (uint8_t i = 0U; i < line_num_tokens; i++)
+    {
+        bool is_variable = ((variables & (1UL << i)) != 0U);
+        const uint8_t* token = (const uint8_t*)(WILDCARD);
+        uint32_t token_len = WILDCARD_LEN;
+        if (is_variable == false)
+        {
+            token = &(line[line_token_offset[i]]);
+            token_len = line_token_len[i];
+        }
+
+        uint32_t separator = (i > 0U) ? 1U : 0U;
+        if (len + separator + token_len > MAX_TEMPLATE_LEN)
+        {   return false;   }
+        if (separator != 0U)
+        {
+            tpl->text[len] = ' ';
+            len = len + 1U;
+        }
+        tpl->token_offset[i] = (uint8_t)(len);
+        tpl->token_len[i] = (uint8_t)(token_len);
+        memcpy(&(tpl->text[len]), token, token_len);
+        len = len + token_len;
+    }
+
+    tpl->len = (uint8_t)(len);
+    tpl->num_tokens = line_num_tokens;
+    tpl->variables = variables;
+    tpl->last_used = 0U;
+    tpl->id = next_id;
+    next_id = (next_id == UINT16_MAX) ? 1U : (next_id + 1U);
+    changed = true;
+
+    return true;
+}
+
+/**
+ * @details This function takes the next unused template of the table, or
+ * the least recently used one if the table is full.
+ */
+UARTTemplates::s_template* UARTTemplates::get_free()
+{
+    if (num_templates < MAX_TEMPLATES)
+    {
+        num_templates = num_templates + 1U;
+        return &(templates[num_templates - 1U]);
+    }
+
+    uint8_t oldest = 0U;
+    for (uint8_t t = 1U; t < num_templates; t++)
+    {
+        if (templates[t].last_used < templates[oldest].last_used)
+        {   oldest = t;   }
+    }
+
+    return &(templates[oldest]);
+}
+
+/**
+ * @details This function compares the token text of the line with the one
+ * of the template.
+ */
+bool UARTTemplates::token_equal(const s_template* tpl, const uint8_t* line,
+        const uint8_t i)
+{
+    if (tpl->token_len[i] != line_token_len[i])
+    {   return false;   }
+
+    return (memcmp((const void*)(&(tpl->text[tpl->token_offset[i]])),
+        (const void*)(&(line[line_token_offset[i]])), tpl->token_len[i]) == 0);
+}
+
+/**
+ * @details This function writes the value in groups of 7 bits, least
+ * significant first, with the most significant bit set in all the bytes but
+ * the last one.
+ */
+uint32_t UARTTemplates::write_varint(uint32_t value, uint8_t* out)
+{
+    uint32_t size = 0U;
+    while (value >= 0x80U)
+    {
+        out[size] = (uint8_t)((value & 0x7FU) | 0x80U);
+        value = value >> 7;
+        size = size + 1U;
+    }
+    out[size] = (uint8_t)(value);
+
+    return size + 1U;
+}
+
+/*****************************************************************************/
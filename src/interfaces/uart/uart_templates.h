@@ -0,0 +1,377 @@
+/**
+ * @file    uart_templates.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx log lines template miner (Drain-style) header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_TEMPLATES_H
+#define UART_TEMPLATES_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief Online log lines template miner and encoder (Drain-style). Lines
+ * are split in space separated tokens and compared with the learned
+ * templates that have the same number of tokens: a line matches the most
+ * similar one if at least half of its constant tokens are equal (and the
+ * first one, if constant). The tokens that differ become variables of the
+ * template, and lines that don't match any template start a new one (with
+ * the tokens that contain digits as its variables). Each line is encoded as
+ * the template ID and the values of its variable tokens, so the line is
+ * rebuilt exactly by replacing the "<*>" tokens of the template text.
+ */
+class UARTTemplates
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+    public:
+
+        /**
+         * @brief Maximum number of templates (the least recently used one
+         * is replaced when a new template doesn't fit).
+         */
+        static constexpr uint8_t MAX_TEMPLATES = 64U;
+
+        /**
+         * @brief Maximum number of tokens of a line to be encoded.
+         */
+        static constexpr uint8_t MAX_TOKENS = 32U;
+
+        /**
+         * @brief Maximum length of a template text.
+         */
+        static constexpr uint8_t MAX_TEMPLATE_LEN = 160U;
+
+        /**
+         * @brief Maximum length of a variable token.
+         */
+        static constexpr uint8_t MAX_ARG_LEN = 0x7FU;
+
+        /**
+         * @brief Variable token argument marker of a number (followed by its
+         * value as LEB128 instead of its text).
+         */
+        static constexpr uint8_t ARG_NUMBER = 0x80U;
+
+        /**
+         * @brief Template ID of lines that are not encoded (followed by the
+         * line as is).
+         */
+        static constexpr uint16_t RAW_ID = 0U;
+
+        /**
+         * @brief Text of the variable tokens in the templates.
+         */
+        static constexpr char WILDCARD[] = "<*>";
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Length of the variable tokens text.
+         */
+        static constexpr uint8_t WILDCARD_LEN = 3U;
+
+        /**
+         * @brief Maximum number of digits of a variable token encoded as a
+         * number (fits in 32 bits).
+         */
+        static constexpr uint8_t MAX_NUMBER_DIGITS = 9U;
+
+        /**
+         * @brief No template found.
+         */
+        static constexpr uint8_t NO_TEMPLATE = 0xFFU;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+    private:
+
+        /**
+         * @brief Learned template.
+         */
+        struct s_template
+        {
+            // Template text (tokens separated by spaces, "<*>" variables)
+            uint8_t text[MAX_TEMPLATE_LEN];
+
+            // Position and length of each token in the text
+            uint8_t token_offset[MAX_TOKENS];
+            uint8_t token_len[MAX_TOKENS];
+
+            // Variable tokens (bit per token)
+            uint32_t variables;
+
+            // Last use mark (for replacement)
+            uint32_t last_used;
+
+            // Template ID
+            uint16_t id;
+
+            // Template text length and number of tokens
+            uint8_t len;
+            uint8_t num_tokens;
+        };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new Templates object (disabled).
+         */
+        UARTTemplates();
+
+        /**
+         * @brief Enable (with an empty templates table) or disable the
+         * miner.
+         * @param enable Enable or disable.
+         * @return true Configuration success.
+         * @return false Templates table allocation fail.
+         */
+        bool configure(const bool enable);
+
+        /**
+         * @brief Check if the miner is enabled.
+         * @return true Enabled.
+         * @return false Disabled.
+         */
+        bool is_enabled();
+
+        /**
+         * @brief Encode a line with its template, learning it.
+         * @param line Line data.
+         * @param len Line length.
+         * @param out Encoded record buffer (at least len + 1 bytes).
+         * @param out_size Encoded record buffer size.
+         * @return uint32_t Encoded record length (0 on fail).
+         */
+        uint32_t encode(const uint8_t* line, const uint32_t len,
+                uint8_t* out, const uint32_t out_size);
+
+        /**
+         * @brief Encode a line as is (raw ID).
+         * @param line Line data.
+         * @param len Line length.
+         * @param out Encoded record buffer (at least len + 1 bytes).
+         * @param out_size Encoded record buffer size.
+         * @return uint32_t Encoded record length (0 on fail).
+         */
+        uint32_t encode_raw(const uint8_t* line, const uint32_t len,
+                uint8_t* out, const uint32_t out_size);
+
+        /**
+         * @brief Check if the templates have changed since they were last
+         * marked as published.
+         * @return true Templates changed.
+         * @return false No changes.
+         */
+        bool is_changed();
+
+        /**
+         * @brief Mark the current templates as published.
+         */
+        void set_published();
+
+        /**
+         * @brief Get the number of templates.
+         * @return uint8_t Number of templates.
+         */
+        uint8_t get_num_templates();
+
+        /**
+         * @brief Get a template.
+         * @param i Template index.
+         * @param id Template ID.
+         * @param text Template text.
+         * @return uint32_t Template text length (0 if there is no template
+         * with that index).
+         */
+        uint32_t get_template(const uint8_t i, uint16_t* id,
+                const uint8_t** text);
+
+        /**
+         * @brief Get the number of lines encoded with a template.
+         * @return uint32_t Number of lines.
+         */
+        uint32_t get_num_encoded();
+
+        /**
+         * @brief Get the number of lines encoded as is.
+         * @return uint32_t Number of lines.
+         */
+        uint32_t get_num_raw();
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Split a line in its space separated tokens.
+         * @param line Line data.
+         * @param len Line length.
+         * @return true Line split.
+         * @return false Too many tokens.
+         */
+        bool tokenize(const uint8_t* line, const uint32_t len);
+
+        /**
+         * @brief Find the most similar template to the line tokens.
+         * @param line Line data.
+         * @return uint8_t Template index (NO_TEMPLATE if none is similar).
+         */
+        uint8_t find(const uint8_t* line);
+
+        /**
+         * @brief Build a template text from the line tokens.
+         * @param tpl Template to build.
+         * @param line Line data.
+         * @param variables Variable tokens (bit per token).
+         * @return true Template built.
+         * @return false Template text too long.
+         */
+        bool build(s_template* tpl, const uint8_t* line,
+                const uint32_t variables);
+
+        /**
+         * @brief Get a free template (the least recently used one if the
+         * table is full).
+         * @return s_template* Template.
+         */
+        s_template* get_free();
+
+        /**
+         * @brief Check if a line token is equal to a template token.
+         * @param tpl Template.
+         * @param line Line data.
+         * @param i Token index.
+         * @return true Equal tokens.
+         * @return false Different tokens.
+         */
+        bool token_equal(const s_template* tpl, const uint8_t* line,
+                const uint8_t i);
+
+        /**
+         * @brief Write a value as LEB128.
+         * @param value Value to write.
+         * @param out Output buffer.
+         * @return uint32_t Number of bytes written (5 at most).
+         */
+        static uint32_t write_varint(uint32_t value, uint8_t* out);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Templates table (allocated when enabled).
+         */
+        s_template* templates;
+
+        /**
+         * @brief Number of templates.
+         */
+        uint8_t num_templates;
+
+        /**
+         * @brief ID of the next template (IDs are not reused, so old
+         * records can still be decoded with old templates).
+         */
+        uint16_t next_id;
+
+        /**
+         * @brief Use mark counter.
+         */
+        uint32_t use_count;
+
+        /**
+         * @brief Templates changed since last marked as published.
+         */
+        bool changed;
+
+        /**
+         * @brief Tokens of the line being encoded.
+         */
+        uint16_t line_token_offset[MAX_TOKENS];
+        uint16_t line_token_len[MAX_TOKENS];
+        uint8_t line_num_tokens;
+
+        /**
+         * @brief Tokens of the line being encoded that contain digits (bit
+         * per token).
+         */
+        uint32_t line_digits;
+
+        /**
+         * @brief Number of lines encoded with a template.
+         */
+        uint32_t num_encoded;
+
+        /**
+         * @brief Number of lines encoded as is.
+         */
+        uint32_t num_raw;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_TEMPLATES_H */
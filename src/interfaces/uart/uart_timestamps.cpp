@@ -0,0 +1,135 @@
+/**
+ * @file    uart_timestamps.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx Data Arrival Timestamps source file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "uart_timestamps.h"
+
+// ESP-IDF High Resolution Timer
+#include "esp_timer.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The constructor of the class initializes an empty queue.
+ */
+UARTTimestamps::UARTTimestamps()
+{
+    for (uint32_t i = 0U; i < NUM_MARKS; i++)
+    {
+        marks[i].end = 0U;
+        marks[i].t_us = 0;
+    }
+    reset();
+}
+
+/**
+ * @details This function clears the queue read/write counters.
+ */
+void UARTTimestamps::reset()
+{
+    head.store(0U, std::memory_order_relaxed);
+    tail.store(0U, std::memory_order_relaxed);
+}
+
+/**
+ * @details This function stores the mark and publish it to the consumer
+ * (release ordering, so the consumer sees the mark before the new counter).
+ */
+void UARTTimestamps::push(const uint32_t end, const int64_t t_us)
+{
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_acquire);
+
+    if (h - t >= NUM_MARKS)
+    {   return;   }
+
+    marks[h & (NUM_MARKS - 1U)].end = end;
+    marks[h & (NUM_MARKS - 1U)].t_us = t_us;
+    head.store(h + 1U, std::memory_order_release);
+}
+
+/**
+ * @details This function discards the marks of the chunks that end at or
+ * before the provided offset (wrap-around safe), so they are not used to
+ * estimate the arrival time of next bytes.
+ */
+void UARTTimestamps::release(const uint32_t offset)
+{
+    uint32_t h = head.load(std::memory_order_acquire);
+    uint32_t t = tail.load(std::memory_order_relaxed);
+
+    while (t != h)
+    {
+        // Stop at the first chunk that contains the byte
+        uint32_t bytes_after = marks[t & (NUM_MARKS - 1U)].end - offset;
+        if ( (bytes_after > 0U) && (bytes_after <= (UINT32_MAX >> 1)) )
+        {   break;   }
+        t = t + 1U;
+    }
+
+    tail.store(t, std::memory_order_release);
+}
+
+/**
+ * @details This function releases the marks of the chunks that end before the
+ * requested byte, then estimates the byte arrival time from the capture time
+ * of its chunk minus one character time per each byte received after it in
+ * the chunk. If there is no mark for the byte yet (the producer has not
+ * pushed it or it was dropped), current time is used.
+ */
+int64_t UARTTimestamps::byte_time(const uint32_t offset,
+        const uint32_t char_time_us)
+{
+    release(offset);
+
+    uint32_t h = head.load(std::memory_order_acquire);
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == h)
+    {   return esp_timer_get_time();   }
+
+    s_mark* mark = &(marks[t & (NUM_MARKS - 1U)]);
+    uint32_t bytes_after = mark->end - offset;
+
+    return mark->t_us -
+        ((int64_t)(bytes_after - 1U) * (int64_t)(char_time_us));
+}
+
+/*****************************************************************************/
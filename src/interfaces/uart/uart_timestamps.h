@@ -0,0 +1,164 @@
+/**
+ * @file    uart_timestamps.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART Rx Data Arrival Timestamps header file.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UART_TIMESTAMPS_H
+#define UART_TIMESTAMPS_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief Single-producer single-consumer lock-free queue of arrival time
+ * marks of the data written into an UART Rx ring buffer. The capture side
+ * pushes a mark (ring buffer write counter + esp_timer time) after each
+ * captured chunk, and the publisher side gets the estimated arrival time of
+ * any byte from the mark of the chunk that contains it, assuming the bytes
+ * of a chunk were received back to back just before it was captured.
+ */
+class UARTTimestamps
+{
+    /******************************************************************/
+
+    /* Private Constants */
+
+    private:
+
+        /**
+         * @brief Number of marks that can be queued (power of two).
+         */
+        static constexpr uint32_t NUM_MARKS = 64U;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+    private:
+
+        /**
+         * @brief Arrival time mark of a captured chunk.
+         */
+        struct s_mark
+        {
+            // Ring buffer write counter after the chunk was written
+            uint32_t end;
+
+            // Capture time of the chunk (us)
+            int64_t t_us;
+        };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new Timestamps object.
+         */
+        UARTTimestamps();
+
+        /**
+         * @brief Clear all the marks. Must not be called while producer or
+         * consumer are running.
+         */
+        void reset();
+
+        /**
+         * @brief Add the arrival time mark of a captured chunk (producer
+         * side). The mark is dropped if the queue is full.
+         * @param end Ring buffer write counter after the chunk.
+         * @param t_us Capture time of the chunk (us).
+         */
+        void push(const uint32_t end, const int64_t t_us);
+
+        /**
+         * @brief Release the marks of the chunks that end before a byte
+         * (consumer side).
+         * @param offset Ring buffer read counter of the byte.
+         */
+        void release(const uint32_t offset);
+
+        /**
+         * @brief Get the estimated arrival time of a byte (consumer side).
+         * Marks of chunks before the byte are released, so bytes must be
+         * requested in order.
+         * @param offset Ring buffer read counter of the byte.
+         * @param char_time_us UART character time (us).
+         * @return int64_t Estimated arrival time of the byte (us).
+         */
+        int64_t byte_time(const uint32_t offset, const uint32_t char_time_us);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Queued marks.
+         */
+        s_mark marks[NUM_MARKS];
+
+        /**
+         * @brief Write counter (only modified by the producer).
+         */
+        std::atomic<uint32_t> head;
+
+        /**
+         * @brief Read counter (only modified by the consumer).
+         */
+        std::atomic<uint32_t> tail;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UART_TIMESTAMPS_H */
@@ -138,17 +138,15 @@ bool single_str_from_array_of_str(int argc, char* array_str[],
 }
 
 /**
- * @details This function count the number of words in the provided "str_in"
- * string, store it in the provided "s_str_cmd_args->argc", then use it to
- * loop searching for a space character using a pointer in order to find the
- * start address of each word and copy each word to the provided
- * "s_str_cmd_args->argv" array of strings to return it back.
+ * @details This function loop through the provided "str_in" string skipping
+ * the separator characters (space, CR and LF) to find the start address of
+ * each word, then copy each word (truncated to the argument maximum length)
+ * to the provided "s_str_cmd_args->argv" array of strings and increase the
+ * "s_str_cmd_args->argc" counter.
  */
 void str_parse_cmd_args(char* str_in, ns_misc::s_str_cmd_args* cmd_args)
 {
-    // Get Arguments
     char* ptr_data = str_in;
-    char* ptr_argv = NULL;
 
     // Clear any previous parse result
     cmd_args->argc = 0U;
@@ -156,30 +154,34 @@ void str_parse_cmd_args(char* str_in, ns_misc::s_str_cmd_args* cmd_args)
     for (uint8_t i = 0; i < ns_const::MAX_STR_ARGV; i++)
     {   cmd_args->argv[i][0] = '\0';   }
 
-    // Count number of words in the string
-    cmd_args->argc = str_count_words(str_in);
+    // Check for valid input
+    if (ptr_data == nullptr)
+    {   return;   }
 
-    for (uint8_t i = 0; i < cmd_args->argc; i++)
+    while (cmd_args->argc < (int)(ns_const::MAX_STR_ARGV))
     {
-        // Break if number of arguments is large than buffer
-        if (i >= ns_const::MAX_STR_ARGV)
+        // Skip separators until next word
+        while ( (*ptr_data == ' ') || (*ptr_data == '\r') ||
+                (*ptr_data == '\n') )
+        {   ptr_data = ptr_data + 1;   }
+        if (*ptr_data == '\0')
         {   break;   }
 
-        // Point to next argument
-        ptr_argv = strstr(ptr_data, " ");
-        if (ptr_argv == NULL)
-        {
-            // No ' ' character found, so it is last command, lets get it
-            strncpy(cmd_args->argv[i], ptr_data, strlen(ptr_data));
-            cmd_args->argv[i][ns_const::MAX_STR_CMD_ARG_LEN-1] = '\0';
-            break;
-        }
-        ptr_data = ptr_data + (ptr_argv - ptr_data) + 1;
-        ptr_argv = ptr_argv + 1;
-
-        // Get the argument
-        str_read_until_char(ptr_argv, strlen(ptr_argv), ' ',
-            cmd_args->argv[i], ns_const::MAX_STR_CMD_ARG_LEN);
+        // Get word length
+        size_t word_len = 0U;
+        while ( (ptr_data[word_len] != '\0') && (ptr_data[word_len] != ' ') &&
+                (ptr_data[word_len] != '\r') && (ptr_data[word_len] != '\n') )
+        {   word_len = word_len + 1U;   }
+
+        // Copy the word
+        size_t copy_len = word_len;
+        if (copy_len > ns_const::MAX_STR_CMD_ARG_LEN - 1U)
+        {   copy_len = ns_const::MAX_STR_CMD_ARG_LEN - 1U;   }
+        memcpy(cmd_args->argv[cmd_args->argc], ptr_data, copy_len);
+        cmd_args->argv[cmd_args->argc][copy_len] = '\0';
+        cmd_args->argc = cmd_args->argc + 1;
+
+        ptr_data = ptr_data + word_len;
     }
 }
 
@@ -199,7 +201,7 @@ uint32_t str_count_words(const char* str_in)
     {   return 0;   }
 
     // Check if string just has 1 character
-    const size_t str_in_len = sizeof(str_in);
+    const size_t str_in_len = strlen(str_in);
     if (str_in_len == 1)
     {   return 1;   }
 
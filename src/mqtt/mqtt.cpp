@@ -24,6 +24,34 @@
  * mosquitto_pub -h "test.mosquitto.org" -p 1883
  *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "bauds 9600"
  *
+ * Detect UART Port N speed from its Rx line (reported on the status topic):
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "autobaud"
+ *
+ * Configure UART Port N for a 2 Mbaud 8E1 target:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "profile highspeed"
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "format 8E1"
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "bauds 2000000"
+ *
+ * Use the Event-Driven capture engine (UART Driver + task) on UART Port N:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "engine event"
+ *
+ * Split UART Port N Rx data into COBS frames instead of lines:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "framing cobs"
+ *
+ * Batch UART Port N Rx lines into messages of up to 1024 bytes or 200ms:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "batch 1024 200"
+ *
+ * Timestamp each UART Port N Rx frame with its first byte arrival time:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "timestamps on"
+ *
  * Enable Logging of UART Port N:
  * mosquitto_pub -h "test.mosquitto.org" -p 1883
  *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "enable"
@@ -32,10 +60,75 @@
  * mosquitto_pub -h "test.mosquitto.org" -p 1883
  *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "disable"
  *
+ * Merge both directions of a link sniffed by UART Ports 1 and 2 into the
+ * UART Port 1 Rx topic:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/1/cfg" -m "pair 2"
+ *
+ * Bridge UART Ports 1 and 2 to log a link as a man-in-the-middle:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/1/cfg" -m "bridge 2"
+ *
+ * Publish the line errors and BREAKs of UART Port N in its Rx data:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "events on"
+ *
+ * Add a sequence number and stream offset to UART Port N Rx messages:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "seq on"
+ *
+ * Only publish the UART Port N lines that contain "ERROR":
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "filter include ERROR"
+ *
+ * Collapse the UART Port N identical consecutive lines received within 1
+ * minute into a single "repeated N times" message:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "dedup 60000"
+ *
+ * Publish only a summary of the UART Port N frames while the uplink can't
+ * keep up with its capture (reported on "/XXXXXXXXXXXX/status/uart"):
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "overload summary"
+ *
+ * Publish UART Port N log lines as template IDs and variables (templates on
+ * the retained "/XXXXXXXXXXXX/uart/N/templates" topic):
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "templates on"
+ *
+ * Compress the UART Port N Rx messages:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "compress on"
+ *
+ * Sniff a Modbus RTU bus on UART Port N (transactions records published on
+ * "/XXXXXXXXXXXX/uart/N/modbus/<slave>"):
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "decoder modbus 500"
+ *
+ * Decode the NMEA 0183 sentences of a GPS receiver on UART Port N (fix
+ * changes published on "/XXXXXXXXXXXX/uart/N/nmea"):
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "decoder nmea"
+ *
+ * Keep the last 64KB of UART Port N (16KB after the trigger) and dump them
+ * when a frame contains "panic":
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "rec 64 16"
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "rec match panic"
+ *
+ * Expose UART Port N as a raw TCP serial server on TCP port 5001:
+ * mosquitto_pub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/cfg" -m "tcp 5001"
+ *
  * Transmit a message through UART Port N:
  * mosquitto_pub -h "test.mosquitto.org" -p 1883
  *               -t "/XXXXXXXXXXXX/uart/N/tx" -m "the message to send"
  *
+ * Check the messages accepted to be transmitted through UART Port N:
+ * mosquitto_sub -h "test.mosquitto.org" -p 1883
+ *               -t "/XXXXXXXXXXXX/uart/N/tx/echo"
+ *
  * Check for current UARTs configurations (periodically sent by device):
  * mosquitto_sub -F '%I\n%t\n%p\n' -h "test.mosquitto.org" -p 1883
  *               -t "/XXXXXXXXXXXX/status/uart"
@@ -114,11 +207,14 @@ static void cb_msg_rx(char* topic, uint8_t* payload, unsigned int length)
     Serial.println("MQTT MSG RX");
     Serial.printf("  Topic: %s\n", topic);
 
-    if (length >= MAX_MQTT_PAYLOAD_LENGTH)
-    {   length = MAX_MQTT_PAYLOAD_LENGTH - 1U;   }
+    // Only the text copy of the payload is limited (binary data handlers get
+    // the full payload)
+    unsigned int str_length = length;
+    if (str_length >= MAX_MQTT_PAYLOAD_LENGTH)
+    {   str_length = MAX_MQTT_PAYLOAD_LENGTH - 1U;   }
 
     unsigned int i = 0;
-    while (i < length)
+    while (i < str_length)
     {
         payload_str[i] = (char)(payload[i]);
         i = i + 1;
@@ -131,7 +227,7 @@ static void cb_msg_rx(char* topic, uint8_t* payload, unsigned int length)
     MQTT.MqttFuota.mqtt_msg_rx(topic, payload, (uint32_t)(length));
 
     // Handle Message by Topic
-    MQTT.handle_msg_rx(topic, payload_str);
+    MQTT.handle_msg_rx(topic, payload_str, payload, (uint32_t)(length));
 }
 
 /*****************************************************************************/
@@ -177,7 +273,7 @@ bool MQTTCommunication::init(WiFiClient* wifi_client)
 
     WIFIClient = wifi_client;
     MQTTClient = new(bss_memory_mqtt_client) PubSubClient(*wifi_client);
-    MQTTClient->setBufferSize(2048);
+    MQTTClient->setBufferSize(MQTT_BUFFER_SIZE);
     MQTTClient->setServer(MQTT_SERVER, MQTT_PORT);
     MQTTClient->setCallback(cb_msg_rx);
 
@@ -234,6 +330,86 @@ bool MQTTCommunication::publish(const char* topic, const char* payload)
     return publish_ok;
 }
 
+bool MQTTCommunication::publish(const char* topic, const uint8_t* payload,
+        const size_t length)
+{
+    bool publish_ok = false;
+
+    // Do nothing if is not connected
+    if (is_connected() == false)
+    {   return false;   }
+
+    publish_ok = (bool)(MQTTClient->publish(topic, payload,
+        (unsigned int)(length)));
+    if (publish_ok == false)
+    {   Serial.println("[Error] MQTT Publish Fail");   }
+
+    return publish_ok;
+}
+
+bool MQTTCommunication::publish(const char* topic, const uint8_t* header,
+        const size_t header_length, const uint8_t* payload,
+        const size_t length)
+{
+    bool publish_ok = false;
+
+    // Do nothing if is not connected
+    if (is_connected() == false)
+    {   return false;   }
+
+    // Stream the header and the payload (no copy to join them)
+    publish_ok = (bool)(MQTTClient->beginPublish(topic,
+        (unsigned int)(header_length + length), false));
+    if (publish_ok)
+    {
+        size_t num_written = MQTTClient->write(header, header_length);
+        num_written = num_written + MQTTClient->write(payload, length);
+        publish_ok = (MQTTClient->endPublish() == 1) &&
+            (num_written == header_length + length);
+    }
+    if (publish_ok == false)
+    {   Serial.println("[Error] MQTT Publish Fail");   }
+
+    return publish_ok;
+}
+
+bool MQTTCommunication::publish_begin(const char* topic,
+        const size_t length, const bool retained)
+{
+    bool publish_ok = false;
+
+    // Do nothing if is not connected
+    if (is_connected() == false)
+    {   return false;   }
+
+    // The payload is streamed by parts (it doesn't need to fit the buffer)
+    publish_ok = (bool)(MQTTClient->beginPublish(topic,
+        (unsigned int)(length), retained));
+    if (publish_ok == false)
+    {   Serial.println("[Error] MQTT Publish Fail");   }
+
+    return publish_ok;
+}
+
+bool MQTTCommunication::publish_write(const uint8_t* data,
+        const size_t length)
+{
+    // Do nothing if there is nothing to write
+    if (length == 0U)
+    {   return true;   }
+
+    return (MQTTClient->write(data, length) == length);
+}
+
+bool MQTTCommunication::publish_end()
+{
+    bool publish_ok = (MQTTClient->endPublish() == 1);
+    if (publish_ok == false)
+    {   Serial.println("[Error] MQTT Publish Fail");   }
+
+    return publish_ok;
+}
+
 bool MQTTCommunication::subscribe(const char* topic)
 {
     bool subscribe_ok = false;
@@ -250,7 +426,8 @@ bool MQTTCommunication::subscribe(const char* topic)
     return subscribe_ok;
 }
 
-void MQTTCommunication::handle_msg_rx(const char* topic, char* payload)
+void MQTTCommunication::handle_msg_rx(const char* topic, char* payload,
+        const uint8_t* data, const uint32_t length)
 {
     using namespace ns_misc;
 
@@ -273,16 +450,18 @@ void MQTTCommunication::handle_msg_rx(const char* topic, char* payload)
             {   return;   }
 
             // UART Configuration
-            IfaceUART.configure(uart_n, cmd_args.argc,
-                (char**)(cmd_args.argv));
+            char* argv[ns_const::MAX_STR_ARGV];
+            for (uint8_t i = 0U; i < ns_const::MAX_STR_ARGV; i++)
+            {   argv[i] = cmd_args.argv[i];   }
+            IfaceUART.configure(uart_n, cmd_args.argc, argv);
             return;
         }
 
         // Topic UART Port Transmission ("/XXXXXXXXXXXX/uart/N/tx")
         if (strcmp(topic, IfaceUART.get_topic_tx(uart_n)) == 0)
         {
-            // Transmit UART Message
-            IfaceUART.uart_tx_msg(uart_n, payload);
+            // Queue UART Message (full payload, binary safe)
+            IfaceUART.uart_tx_msg(uart_n, data, (size_t)(length));
             return;
         }
     }
@@ -98,9 +98,24 @@ class MQTTCommunication
 
         bool publish(const char* topic, const char* payload);
 
+        bool publish(const char* topic, const uint8_t* payload,
+                const size_t length);
+
+        bool publish(const char* topic, const uint8_t* header,
+                const size_t header_length, const uint8_t* payload,
+                const size_t length);
+
+        bool publish_begin(const char* topic, const size_t length,
+                const bool retained);
+
+        bool publish_write(const uint8_t* data, const size_t length);
+
+        bool publish_end();
+
         bool subscribe(const char* topic);
 
-        void handle_msg_rx(const char* topic, char* payload);
+        void handle_msg_rx(const char* topic, char* payload,
+                const uint8_t* data, const uint32_t length);
 
         void msg_rx_in(const char* topic, char* payload);
 
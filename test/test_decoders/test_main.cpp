@@ -0,0 +1,420 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESPMULTILOG UART protocol decoders host tests (pio test -e native). Each
+ * test replays a capture file through a decoder of the decoders registry,
+ * checks the emitted records and reports the decoder throughput.
+ *
+ * The capture files are a sequence of UART Port timestamped records, as they
+ * are published on the rx topic of a Port with "timestamps on" (see the
+ * README): flags (1 byte), arrival time of the first byte (8 bytes, us),
+ * frame length (2 bytes), frame data and, if the flags bit 0 is set, the
+ * deltas count (2 bytes) and list (2 bytes each). All little endian.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// C++ Standard Libraries
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Unit Testing Framework
+#include <unity.h>
+
+// UART Protocol Decoders Registry
+#include "../../src/interfaces/uart/uart_decoders.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+/**
+ * @brief Size of the header of a timestamped record (flags, timestamp and
+ * frame length).
+ */
+static constexpr uint32_t REC_HEADER_SIZE = 11U;
+
+/**
+ * @brief Timestamped record flag: The deltas list is present.
+ */
+static constexpr uint8_t REC_FLAG_DELTAS = 0x01U;
+
+/**
+ * @brief Number of bytes replayed to measure the decoders throughput.
+ */
+static constexpr uint64_t THROUGHPUT_BYTES = (8U * 1024U * 1024U);
+
+/**
+ * @brief Character time of the Modbus capture Port (9600 bauds, 8N1).
+ */
+static constexpr uint32_t MODBUS_CHAR_TIME_US = 1042U;
+
+/**
+ * @brief Character time of the NMEA capture Port (115200 bauds, 8N1).
+ */
+static constexpr uint32_t NMEA_CHAR_TIME_US = 87U;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Decoder emitted record.
+ */
+struct s_record
+{
+    std::string subtopic;
+    std::vector<uint8_t> data;
+};
+
+/*****************************************************************************/
+
+/* Test Data */
+
+/**
+ * @brief Records emitted by the decoder under test.
+ */
+static std::vector<s_record> records;
+
+/**
+ * @brief Decoder storage (as the one of each UART Port).
+ */
+alignas(UARTDecoders::STORAGE_ALIGN) static uint8_t
+    decoder_storage[UARTDecoders::STORAGE_SIZE];
+
+/*****************************************************************************/
+
+/* Helpers */
+
+/**
+ * @brief Decoder sink that keeps the emitted records.
+ */
+static bool sink_keep(void* ctx, const char* subtopic,
+        const uint8_t* record, const uint32_t len)
+{
+    (void)(ctx);
+
+    s_record rec;
+    rec.subtopic = (subtopic != nullptr) ? subtopic : "";
+    rec.data.assign(record, record + len);
+    records.push_back(rec);
+
+    return true;
+}
+
+/**
+ * @brief Decoder sink that drops the emitted records (throughput runs).
+ */
+static bool sink_drop(void* ctx, const char* subtopic,
+        const uint8_t* record, const uint32_t len)
+{
+    (void)(ctx);
+    (void)(subtopic);
+    (void)(record);
+    (void)(len);
+
+    return true;
+}
+
+/**
+ * @brief Read a capture file of this test directory (from the directory of
+ * this source file, or from the project directory).
+ */
+static bool capture_load(const char* name, std::vector<uint8_t>* capture)
+{
+    std::string dir = __FILE__;
+    size_t dir_end = dir.find_last_of("/\\");
+    dir = (dir_end != std::string::npos) ? dir.substr(0U, dir_end + 1U) : "";
+
+    const std::string paths[] = { dir + name,
+        std::string("test/test_decoders/") + name };
+    for (const std::string& path : paths)
+    {
+        FILE* file = fopen(path.c_str(), "rb");
+        if (file == nullptr)
+        {   continue;   }
+
+        uint8_t buffer[1024];
+        size_t num_read = 0U;
+        capture->clear();
+        while ((num_read = fread(buffer, 1U, sizeof(buffer), file)) > 0U)
+        {   capture->insert(capture->end(), buffer, buffer + num_read);   }
+        fclose(file);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Build a decoder of the registry by its name.
+ */
+static UARTDecoder* decoder_create(const char* name,
+        const UARTDecoder::t_sink sink, const uint32_t char_time_us)
+{
+    UARTDecoder* decoder = UARTDecoders::create(UARTDecoders::find(name),
+        decoder_storage);
+    if (decoder == nullptr)
+    {   return nullptr;   }
+
+    decoder->set_sink(sink, nullptr);
+    decoder->set_char_time(char_time_us);
+
+    return decoder;
+}
+
+/**
+ * @brief Feed the frames of the capture records to the decoder, as the
+ * UART Port does: the decoder is flushed with the arrival time of each
+ * frame before it is fed. The times are shifted by an offset.
+ * @return uint64_t Number of frame bytes fed (0 if the capture is invalid).
+ */
+static uint64_t capture_replay(UARTDecoder* decoder,
+        const std::vector<uint8_t>& capture, const int64_t t_offset_us,
+        int64_t* t_last_us)
+{
+    uint64_t num_bytes = 0U;
+    size_t pos = 0U;
+    while (pos < capture.size())
+    {
+        if (capture.size() - pos < REC_HEADER_SIZE)
+        {   return 0U;   }
+
+        const uint8_t* rec = &(capture[pos]);
+        uint64_t t = 0U;
+        for (uint8_t i = 0U; i < 8U; i++)
+        {   t = t | ((uint64_t)(rec[1U + i]) << (8U * i));   }
+        uint32_t len = (uint32_t)(rec[9]) | ((uint32_t)(rec[10]) << 8);
+        size_t size = REC_HEADER_SIZE + len;
+        if ((rec[0] & REC_FLAG_DELTAS) != 0U)
+        {
+            if (capture.size() - pos < size + 2U)
+            {   return 0U;   }
+            uint32_t num_deltas = (uint32_t)(rec[size]) |
+                ((uint32_t)(rec[size + 1U]) << 8);
+            size = size + 2U + (2U * num_deltas);
+        }
+        if (capture.size() - pos < size)
+        {   return 0U;   }
+
+        int64_t t_us = (int64_t)(t) + t_offset_us;
+        decoder->flush(t_us);
+        decoder->feed(&(rec[REC_HEADER_SIZE]), len, t_us);
+        num_bytes = num_bytes + len;
+        *t_last_us = t_us;
+        pos = pos + size;
+    }
+
+    return num_bytes;
+}
+
+/**
+ * @brief Replay the capture through a new decoder of the registry until
+ * THROUGHPUT_BYTES bytes are fed (each pass shifted after the previous one),
+ * and report the decoder throughput.
+ */
+static void throughput_report(const char* name,
+        const std::vector<uint8_t>& capture, const uint32_t char_time_us)
+{
+    UARTDecoder* decoder = decoder_create(name, sink_drop, char_time_us);
+    TEST_ASSERT_NOT_NULL(decoder);
+
+    uint64_t num_bytes = 0U;
+    int64_t t_offset_us = 0;
+    int64_t t_last_us = 0;
+    auto t_start = std::chrono::steady_clock::now();
+    while (num_bytes < THROUGHPUT_BYTES)
+    {
+        uint64_t num_fed = capture_replay(decoder, capture, t_offset_us,
+            &t_last_us);
+        TEST_ASSERT_TRUE(num_fed > 0U);
+        num_bytes = num_bytes + num_fed;
+        t_offset_us = t_last_us + 1000000;
+    }
+    decoder->flush(INT64_MAX);
+    auto t_end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(t_end - t_start).count();
+    double mb = (double)(num_bytes) / (1024.0 * 1024.0);
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%s: %.1f MB in %.3f s (%.1f MB/s, "
+        "%u records)", name, mb, seconds,
+        (seconds > 0.0) ? (mb / seconds) : 0.0,
+        (unsigned)(decoder->get_num_records()));
+    TEST_MESSAGE(msg);
+
+    decoder->~UARTDecoder();
+}
+
+/**
+ * @brief Read a little endian field of a record.
+ */
+static uint64_t record_field(const s_record& rec, const size_t offset,
+        const uint8_t size)
+{
+    uint64_t value = 0U;
+    for (uint8_t i = 0U; i < size; i++)
+    {   value = value | ((uint64_t)(rec.data[offset + i]) << (8U * i));   }
+
+    return value;
+}
+
+/*****************************************************************************/
+
+/* Unity Fixtures */
+
+void setUp()
+{
+    records.clear();
+}
+
+void tearDown()
+{}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @brief Modbus RTU capture (9600 bauds): a read holding registers, a write
+ * single register, a frame with a wrong CRC, an exception response and a
+ * read coils request without response.
+ */
+static void test_modbus()
+{
+    std::vector<uint8_t> capture;
+    TEST_ASSERT_TRUE(capture_load("modbus.rec", &capture));
+
+    UARTDecoder* decoder = decoder_create("modbus", sink_keep,
+        MODBUS_CHAR_TIME_US);
+    TEST_ASSERT_NOT_NULL(decoder);
+    int64_t t_last_us = 0;
+    TEST_ASSERT_TRUE(capture_replay(decoder, capture, 0, &t_last_us) > 0U);
+    decoder->flush(INT64_MAX);
+    TEST_ASSERT_EQUAL_UINT32(1U, decoder->get_num_errors());
+    decoder->~UARTDecoder();
+
+    // Transactions records: subtopic (slave), timestamp, latency, function,
+    // exception, address, count and values
+    TEST_ASSERT_EQUAL_UINT32(4U, records.size());
+
+    TEST_ASSERT_EQUAL_STRING("1", records[0].subtopic.c_str());
+    TEST_ASSERT_EQUAL_UINT64(1000000U, record_field(records[0], 0U, 8U));
+    TEST_ASSERT_EQUAL_UINT32(3000U, record_field(records[0], 8U, 4U));
+    TEST_ASSERT_EQUAL_UINT8(0x03U, records[0].data[12]);
+    TEST_ASSERT_EQUAL_UINT8(0U, records[0].data[13]);
+    TEST_ASSERT_EQUAL_UINT16(0x0010U, record_field(records[0], 14U, 2U));
+    TEST_ASSERT_EQUAL_UINT16(2U, record_field(records[0], 16U, 2U));
+    TEST_ASSERT_EQUAL_UINT32(18U + 4U, records[0].data.size());
+
+    TEST_ASSERT_EQUAL_STRING("2", records[1].subtopic.c_str());
+    TEST_ASSERT_EQUAL_UINT32(2000U, record_field(records[1], 8U, 4U));
+    TEST_ASSERT_EQUAL_UINT8(0x06U, records[1].data[12]);
+    TEST_ASSERT_EQUAL_UINT16(0x0001U, record_field(records[1], 14U, 2U));
+    TEST_ASSERT_EQUAL_UINT16(1U, record_field(records[1], 16U, 2U));
+    TEST_ASSERT_EQUAL_UINT32(18U + 2U, records[1].data.size());
+
+    TEST_ASSERT_EQUAL_STRING("3", records[2].subtopic.c_str());
+    TEST_ASSERT_EQUAL_UINT32(1500U, record_field(records[2], 8U, 4U));
+    TEST_ASSERT_EQUAL_UINT8(0x04U, records[2].data[12]);
+    TEST_ASSERT_EQUAL_UINT8(0x02U, records[2].data[13]);
+    TEST_ASSERT_EQUAL_UINT32(18U, records[2].data.size());
+
+    TEST_ASSERT_EQUAL_STRING("4", records[3].subtopic.c_str());
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFU, record_field(records[3], 8U, 4U));
+    TEST_ASSERT_EQUAL_UINT8(0x01U, records[3].data[12]);
+    TEST_ASSERT_EQUAL_UINT16(0x0020U, record_field(records[3], 14U, 2U));
+    TEST_ASSERT_EQUAL_UINT16(8U, record_field(records[3], 16U, 2U));
+
+    throughput_report("modbus", capture, MODBUS_CHAR_TIME_US);
+}
+
+/**
+ * @brief NMEA 0183 capture (115200 bauds): three 1 Hz epochs of GGA and RMC
+ * sentences, with a position change of about 18 m in the second one.
+ */
+static void test_nmea()
+{
+    std::vector<uint8_t> capture;
+    TEST_ASSERT_TRUE(capture_load("nmea.rec", &capture));
+
+    UARTDecoder* decoder = decoder_create("nmea", sink_keep,
+        NMEA_CHAR_TIME_US);
+    TEST_ASSERT_NOT_NULL(decoder);
+    int64_t t_last_us = 0;
+    TEST_ASSERT_TRUE(capture_replay(decoder, capture, 0, &t_last_us) > 0U);
+    decoder->flush(INT64_MAX);
+    TEST_ASSERT_EQUAL_UINT32(0U, decoder->get_num_errors());
+    decoder->~UARTDecoder();
+
+    // Fix changes records (JSON text): the first epoch with all its fields
+    // and the second one with the new position (the third one has no
+    // changes, so it has no record)
+    TEST_ASSERT_EQUAL_UINT32(2U, records.size());
+    std::string first(records[0].data.begin(), records[0].data.end());
+    std::string second(records[1].data.begin(), records[1].data.end());
+    TEST_ASSERT_EQUAL_STRING("", records[0].subtopic.c_str());
+    TEST_ASSERT_TRUE(first.find("\"utc\":\"12:00:00.000\"") !=
+        std::string::npos);
+    TEST_ASSERT_TRUE(first.find("\"lat\":40.4187233") != std::string::npos);
+    TEST_ASSERT_TRUE(first.find("\"lon\":-3.7094633") != std::string::npos);
+    TEST_ASSERT_TRUE(first.find("\"alt\":650.20") != std::string::npos);
+    TEST_ASSERT_TRUE(first.find("\"sats\":8") != std::string::npos);
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"utc\":\"12:00:01.000\",\"lat\":40.4188900,\"lon\":-3.7094633}",
+        second.c_str());
+
+    throughput_report("nmea", capture, NMEA_CHAR_TIME_US);
+}
+
+/*****************************************************************************/
+
+/* Test Runner */
+
+int main(int argc, char** argv)
+{
+    (void)(argc);
+    (void)(argv);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_modbus);
+    RUN_TEST(test_nmea);
+    return UNITY_END();
+}
+
+/*****************************************************************************/